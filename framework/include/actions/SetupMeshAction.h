@@ -28,6 +28,15 @@ public:
 
 private:
   void setupMesh(MooseMesh * mesh);
+
+  /**
+   * Computes the mesh cache key (--mesh-cache) from everything that influences the prepared mesh
+   * and switches to reading the cached mesh if one with that key exists.
+   */
+  void setupMeshCache();
+
+  /// Switches the mesh to a FileMesh reading file_name, keeping the existing parameters if possible
+  void useFileMesh(const std::string & file_name);
 };
 
 #endif // SETUPMESHACTION_H
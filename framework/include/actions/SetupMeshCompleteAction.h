@@ -26,7 +26,12 @@ public:
 
   virtual void act() override;
 
+protected:
+  /// Stores the prepared mesh in the mesh cache (--mesh-cache) so later runs can load it
+  void writeMeshCache();
+
   PerfID _uniform_refine_timer;
+  PerfID _write_mesh_cache_timer;
 };
 
 #endif // SETUPMESHCOMPLETEACTION_H
@@ -221,6 +221,11 @@ public:
    */
   void setInterval(unsigned int interval) { _interval = interval; }
 
+  /**
+   * Return the interval (number of timesteps) between refinement steps.
+   */
+  unsigned int getInterval() const { return _interval; }
+
   /**
    * Get an ErrorVector that will be filled up with values corresponding to the
    * indicator field name passed in.
@@ -34,6 +34,7 @@ class MooseApp;
 class Backup;
 class FEProblemBase;
 class MeshModifier;
+class MooseMesh;
 class InputParameterWarehouse;
 class SystemInfo;
 class CommandLine;
@@ -340,6 +341,23 @@ public:
    */
   bool isUseSplit() const;
 
+  /**
+   * Sets the file the prepared mesh is cached in (--mesh-cache) and whether or not that file
+   * already existed, in which case the mesh was loaded from it.
+   */
+  void setMeshCache(const std::string & file_name, bool hit);
+
+  /**
+   * The file the prepared mesh is cached in, empty if the mesh is not cached
+   */
+  const std::string & meshCacheFile() const { return _mesh_cache_file; }
+
+  /**
+   * Whether or not the mesh was loaded from the mesh cache, so that mesh modifiers and uniform
+   * refinement have already been applied.
+   */
+  bool meshCacheHit() const { return _mesh_cache_hit; }
+
   /**
    * Return true if the recovery file base is set
    */
@@ -598,6 +616,12 @@ protected:
    */
   void restoreCachedBackup();
 
+  /**
+   * Rebuilds the given stale MeshModifier::MeshData on the mesh and the displaced mesh between
+   * two MeshModifiers
+   */
+  void prepareModifiedMesh(MooseMesh * mesh, MooseMesh * displaced_mesh, unsigned int stale);
+
   /**
    * Helper method for dynamic loading of objects
    */
@@ -731,6 +755,12 @@ protected:
   /// Whether or not we are using a (pre-)split mesh (automatically DistributedMesh)
   const bool _use_split;
 
+  /// The file the prepared mesh is cached in (--mesh-cache)
+  std::string _mesh_cache_file;
+
+  /// Whether or not the mesh was loaded from the mesh cache
+  bool _mesh_cache_hit;
+
   /// Whether or not FPE trapping should be turned on.
   bool _trap_fpe;
 
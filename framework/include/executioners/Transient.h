@@ -12,6 +12,8 @@
 
 #include "Executioner.h"
 
+#include "libmesh/numeric_vector.h"
+
 // System includes
 #include <string>
 #include <fstream>
@@ -310,9 +312,61 @@ protected:
 
   void setupTimeIntegrator();
 
+  /**
+   * Relaxes the "relaxed_variables" after the solve of a Picard iteration
+   * @param first_picard_it Whether this is the first Picard iteration of the time step, which
+   * only records the history for Aitken and Anderson
+   */
+  void relaxSolution(bool first_picard_it);
+
+  /// Starts the history of Aitken and Anderson over, at the first Picard iteration of a time step
+  void resetRelaxationHistory();
+
+  /// Relaxes the solution with Aitken's dynamic relaxation factor
+  void relaxAitken(NumericVector<Number> & solution,
+                   const NumericVector<Number> & previous,
+                   const NumericVector<Number> & residual,
+                   bool first_picard_it);
+
+  /// Relaxes the solution with Anderson mixing of the previous Picard iterations
+  void relaxAnderson(NumericVector<Number> & solution,
+                     const NumericVector<Number> & residual,
+                     bool first_picard_it);
+
   /// Relaxation factor for Picard Iteration
   Real _relax_factor;
 
+  /// How to relax the "relaxed_variables" between Picard iterations
+  const MooseEnum _relaxation_method;
+
+  /// Whether the "relaxed_variables" are relaxed at all
+  bool _relax;
+
+  /// The number of previous Picard iterations Anderson mixing uses
+  const unsigned int _anderson_depth;
+
+  /// The Aitken relaxation factor of the previous Picard iteration
+  Real _aitken_factor;
+
+  /// The number of Picard iterations of this time step recorded by Aitken or Anderson
+  unsigned int _relaxation_history_size;
+
+  /// The relaxed solution of the previous Picard iteration for Aitken and Anderson
+  std::unique_ptr<NumericVector<Number>> _relaxed_iterate;
+
+  /// The Picard residuals of the current and previous iterations for Aitken and Anderson
+  std::unique_ptr<NumericVector<Number>> _relax_residual;
+  std::unique_ptr<NumericVector<Number>> _relax_previous_residual;
+
+  /// The iterates of the current and previous Picard iterations and the mixed update for Anderson
+  std::unique_ptr<NumericVector<Number>> _relax_iterate;
+  std::unique_ptr<NumericVector<Number>> _relax_previous_iterate;
+  std::unique_ptr<NumericVector<Number>> _relax_update;
+
+  /// The differences of the residuals and iterates of consecutive Picard iterations for Anderson
+  std::vector<std::unique_ptr<NumericVector<Number>>> _anderson_residual_differences;
+  std::vector<std::unique_ptr<NumericVector<Number>>> _anderson_iterate_differences;
+
   /// The _time when this app solved last.
   /// This allows a sub-app to know if this is the first
   /// Picard iteration or not.
@@ -20,7 +20,9 @@ class Kernel;
 class ComputeFullJacobianThread : public ComputeJacobianThread
 {
 public:
-  ComputeFullJacobianThread(FEProblemBase & fe_problem, const std::set<TagID> & tags);
+  ComputeFullJacobianThread(FEProblemBase & fe_problem,
+                            const std::set<TagID> & tags,
+                            bool lock_free = false);
 
   // Splitting Constructor
   ComputeFullJacobianThread(ComputeFullJacobianThread & x, Threads::split split);
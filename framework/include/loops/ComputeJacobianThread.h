@@ -26,7 +26,14 @@ class Kernel;
 class ComputeJacobianThread : public ThreadedElementLoop<ConstElemRange>
 {
 public:
-  ComputeJacobianThread(FEProblemBase & fe_problem, const std::set<TagID> & tags);
+  /**
+   * @param lock_free When true, cached Jacobian entries are added to the global matrices without
+   *                  acquiring Threads::spin_mtx. Only valid when the range being looped over
+   *                  is a single element color (see MooseMesh::getColoredActiveLocalElementRanges).
+   */
+  ComputeJacobianThread(FEProblemBase & fe_problem,
+                        const std::set<TagID> & tags,
+                        bool lock_free = false);
 
   // Splitting Constructor
   ComputeJacobianThread(ComputeJacobianThread & x, Threads::split split);
@@ -48,6 +55,9 @@ protected:
 
   unsigned int _num_cached;
 
+  // Whether cached Jacobian entries may be added to the global matrices without locking
+  const bool _lock_free;
+
   // Reference to BC storage structures
   const MooseObjectWarehouse<IntegratedBCBase> & _integrated_bcs;
 
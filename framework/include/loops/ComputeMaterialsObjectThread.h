@@ -41,6 +41,7 @@ public:
   virtual void onElement(const Elem * elem) override;
   virtual void onBoundary(const Elem * elem, unsigned int side, BoundaryID bnd_id) override;
   virtual void onInternalSide(const Elem * elem, unsigned int side) override;
+  virtual void postElement(const Elem * elem) override;
 
   void join(const ComputeMaterialsObjectThread & /*y*/);
 
@@ -28,7 +28,14 @@ class Kernel;
 class ComputeResidualThread : public ThreadedElementLoop<ConstElemRange>
 {
 public:
-  ComputeResidualThread(FEProblemBase & fe_problem, const std::set<TagID> & tags);
+  /**
+   * @param lock_free When true, cached residuals are added to the global vectors without
+   *                  acquiring Threads::spin_mtx. Only valid when the range being looped over
+   *                  is a single element color (see MooseMesh::getColoredActiveLocalElementRanges).
+   */
+  ComputeResidualThread(FEProblemBase & fe_problem,
+                        const std::set<TagID> & tags,
+                        bool lock_free = false);
 
   // Splitting Constructor
   ComputeResidualThread(ComputeResidualThread & x, Threads::split split);
@@ -50,6 +57,9 @@ protected:
   const std::set<TagID> & _tags;
   unsigned int _num_cached;
 
+  /// Whether cached residuals may be added to the global vectors without locking
+  const bool _lock_free;
+
   /// Reference to BC storage structures
   const MooseObjectWarehouse<IntegratedBCBase> & _integrated_bcs;
 
@@ -19,6 +19,14 @@ typedef StoredRange<std::vector<std::shared_ptr<GeneralUserObject>>::iterator,
                     std::shared_ptr<GeneralUserObject>>
     GeneralUserObjectRange;
 
+/**
+ * Range over groups of threaded general user objects. Each group holds the copies belonging to a
+ * single thread ID so that no two copies sharing a thread ID are executed concurrently.
+ */
+typedef StoredRange<std::vector<std::vector<std::shared_ptr<GeneralUserObject>>>::iterator,
+                    std::vector<std::shared_ptr<GeneralUserObject>>>
+    GeneralUserObjectGroupRange;
+
 /**
  * This mutex is used to protect the creation of the strings used in the propogation
  * of the error messages.  It's possible for a thread to have acquired the
@@ -43,6 +51,7 @@ public:
   virtual ~ComputeThreadedGeneralUserObjectsThread();
 
   void operator()(const GeneralUserObjectRange & range);
+  void operator()(const GeneralUserObjectGroupRange & range);
 
   void join(const ComputeThreadedGeneralUserObjectsThread & /*y*/) {}
 
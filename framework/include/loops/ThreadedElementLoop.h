@@ -15,6 +15,8 @@
 #include "Assembly.h"
 #include "ThreadedElementLoopBase.h"
 
+#include <chrono>
+
 // Forward declarations
 class SystemBase;
 
@@ -51,7 +53,16 @@ public:
   virtual void neighborSubdomainChanged() override;
 
 protected:
+  /// Starts timing the work done on an element when the problem measures element costs
+  void startElementTimer();
+
+  /// Adds the time since startElementTimer() to the measured cost of the element
+  void stopElementTimer(const Elem * elem);
+
   FEProblemBase & _fe_problem;
+
+  /// When the work on the current element started
+  std::chrono::steady_clock::time_point _element_start_time;
 };
 
 template <typename RangeType>
@@ -104,4 +115,23 @@ ThreadedElementLoop<RangeType>::neighborSubdomainChanged()
                                      ThreadedElementLoopBase<RangeType>::_tid);
 }
 
+template <typename RangeType>
+void
+ThreadedElementLoop<RangeType>::startElementTimer()
+{
+  if (_fe_problem.measureElementCost())
+    _element_start_time = std::chrono::steady_clock::now();
+}
+
+template <typename RangeType>
+void
+ThreadedElementLoop<RangeType>::stopElementTimer(const Elem * elem)
+{
+  if (_fe_problem.measureElementCost())
+    _fe_problem.addElementCost(
+        elem,
+        std::chrono::duration<Real>(std::chrono::steady_clock::now() - _element_start_time).count(),
+        ThreadedElementLoopBase<RangeType>::_tid);
+}
+
 #endif // THREADEDELEMENTLOOP_H
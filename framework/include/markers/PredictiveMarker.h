@@ -0,0 +1,77 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef PREDICTIVEMARKER_H
+#define PREDICTIVEMARKER_H
+
+#include "ErrorFractionMarker.h"
+
+#include <unordered_map>
+#include <unordered_set>
+
+class PredictiveMarker;
+
+template <>
+InputParameters validParams<PredictiveMarker>();
+
+/**
+ * An ErrorFractionMarker that looks ahead in time to reduce the churn of refining and coarsening
+ * the same elements over and over behind a moving feature.
+ *
+ * The error of every element is extrapolated linearly from its value at the previous marker
+ * computation, so elements the feature is moving into get refined before the error arrives.
+ * The refined region is grown by a number of layers of neighbors, and elements are only
+ * coarsened after their error stayed below the coarsening cutoff for a number of consecutive
+ * marker computations. Together this allows adapting the mesh only every few time steps.
+ */
+class PredictiveMarker : public ErrorFractionMarker
+{
+public:
+  PredictiveMarker(const InputParameters & parameters);
+
+  virtual void markerSetup() override;
+
+protected:
+  virtual MarkerValue computeElementMarker() override;
+
+  /// Adds the active elements sharing a side with elem to the set of elements to refine
+  void addNeighbors(const Elem & elem, std::vector<const Elem *> & added);
+
+  /// The number of time steps to extrapolate the error ahead
+  unsigned int _lookahead;
+
+  /// The number of layers of neighbors around the predicted feature to refine as well
+  const unsigned int _buffer_layers;
+
+  /// The number of consecutive marker computations an element must be marked for coarsening
+  const unsigned int _coarsen_delay;
+
+  /// The time step of the last marker computation, the history is only advanced once per step
+  /// when the markers are recomputed during the adaptivity cycles
+  int _history_step;
+
+  ///@{
+  /// The error of the active elements at the marker computation of the previous and of the
+  /// current time step, keyed by unique id since the element ids change when the mesh is adapted
+  std::unordered_map<unique_id_type, Real> _previous_error;
+  std::unordered_map<unique_id_type, Real> _current_error;
+  ///@}
+
+  ///@{
+  /// The number of consecutive marker computations the active elements were below the coarsening
+  /// cutoff up to the previous and up to the current time step
+  std::unordered_map<unique_id_type, unsigned int> _previous_coarsen_count;
+  std::unordered_map<unique_id_type, unsigned int> _coarsen_count;
+  ///@}
+
+  /// The elements marked for refinement in this marker computation
+  std::unordered_set<dof_id_type> _refine_elems;
+};
+
+#endif /* PREDICTIVEMARKER_H */
@@ -170,7 +170,9 @@ public:
 
 protected:
   /**
-   * Evaluate material properties on subdomain
+   * Evaluate material properties on subdomain. By default this calls computeQpProperties() for the
+   * 0th quadrature point of the first element of the subdomain, which must then not depend on the
+   * element or the quadrature point.
    */
   virtual void computeSubdomainProperties();
 
@@ -283,6 +285,21 @@ private:
   bool _has_stateful_property;
 
   bool _overrides_init_stateful_props = true;
+
+  /// Splits the supplied properties of a constant material into shared and stateful ones
+  void sortConstantProperties();
+
+  /// Whether sortConstantProperties() was called
+  bool _constant_props_sorted;
+
+  /// The supplied properties that keep a single value for all qps when the material is constant
+  std::vector<unsigned int> _shared_prop_ids;
+
+  /// The supplied stateful properties, which are swapped per element and stored at every qp
+  std::vector<unsigned int> _stateful_prop_ids;
+
+  /// Whether the properties of a material constant on a subdomain were computed for the subdomain
+  bool _subdomain_props_computed;
 };
 
 template <typename T>
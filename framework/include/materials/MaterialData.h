@@ -77,6 +77,23 @@ public:
   /// Reinit material properties for given element (and possible side)
   void reinit(const std::vector<std::shared_ptr<Material>> & mats);
 
+  /**
+   * Returns true if the current call to reinit() received a different set of materials than the
+   * previous one, in which case the values of properties that are constant on a subdomain may have
+   * been overwritten by other materials in the meantime
+   */
+  bool materialsChanged() const { return _materials_changed; }
+
+  /**
+   * Makes all quadrature points of a property share the value at the 0th one, or stops doing so
+   * @param prop_id The id of the property
+   * @param constant Whether the value is shared
+   */
+  void setConstantProperty(unsigned int prop_id, bool constant);
+
+  /// Whether setConstantProperty() ever made a property constant
+  bool hasConstantProperties() const { return _has_constant_props; }
+
   /// Calls the reset method of Materials to ensure that they are in a proper state.
   void reset(const std::vector<std::shared_ptr<Material>> & mats);
 
@@ -161,6 +178,15 @@ protected:
   /// Status of storage swapping (calling swap sets this to true; swapBack sets it to false)
   bool _swapped;
 
+  /// The materials passed to the most recent call to reinit()
+  const std::vector<std::shared_ptr<Material>> * _last_materials;
+
+  /// Whether the materials passed to reinit() changed since the previous call
+  bool _materials_changed;
+
+  /// Whether any property was made constant, see setConstantProperty()
+  bool _has_constant_props;
+
 private:
   template <typename T>
   MaterialProperty<T> &
@@ -75,6 +75,19 @@ public:
   // save/restore in a file
   virtual void store(std::ostream & stream) = 0;
   virtual void load(std::istream & stream) = 0;
+
+  /**
+   * Makes all quadrature points share the value at the 0th one, see the "constant_on" parameter
+   * of Material. The value then does not have to be copied to the other quadrature points.
+   */
+  void setConstant(bool constant) { _qp_mask = constant ? 0 : ~0u; }
+
+  /// Whether all quadrature points share the value at the 0th one
+  bool isConstant() const { return _qp_mask == 0; }
+
+protected:
+  /// Applied to the quadrature point indices, zero for a constant property
+  unsigned int _qp_mask = ~0u;
 };
 
 template <>
@@ -132,14 +145,14 @@ public:
   /**
    * Get element i out of the array.
    */
-  T & operator[](const unsigned int i) { return _value[i]; }
+  T & operator[](const unsigned int i) { return _value[i & _qp_mask]; }
 
   unsigned int size() const { return _value.size(); }
 
   /**
    * Get element i out of the array.
    */
-  const T & operator[](const unsigned int i) const { return _value[i]; }
+  const T & operator[](const unsigned int i) const { return _value[i & _qp_mask]; }
 
   /**
    *
@@ -220,7 +233,11 @@ template <typename T>
 inline void
 MaterialProperty<T>::resize(int n)
 {
-  _value.resize(n);
+  // The shared value of a constant property has to survive a reallocation
+  if (isConstant())
+    _value.resize(n, T());
+  else
+    _value.resize(n);
 }
 
 template <typename T>
@@ -238,7 +255,8 @@ MaterialProperty<T>::qpCopy(const unsigned int to_qp,
                             const unsigned int from_qp)
 {
   mooseAssert(rhs != NULL, "Assigning NULL?");
-  _value[to_qp] = cast_ptr<const MaterialProperty<T> *>(rhs)->_value[from_qp];
+  const MaterialProperty<T> * rhs_prop = cast_ptr<const MaterialProperty<T> *>(rhs);
+  _value[to_qp & _qp_mask] = rhs_prop->_value[from_qp & rhs_prop->_qp_mask];
 }
 
 template <typename T>
@@ -18,6 +18,7 @@
 class Material;
 class MaterialData;
 class QpMap;
+class MooseMesh;
 
 // libMesh forward declarations
 namespace libMesh
@@ -146,6 +147,19 @@ public:
             unsigned int side,
             unsigned int n_qpoints);
 
+  /**
+   * Moves the properties of the elements that changed owner when the mesh was repartitioned to
+   * their new owner and releases them here. Must be called on all processors after the
+   * repartitioning, while the elements that left this processor are still in the mesh.
+   *
+   * @param material_data MaterialData object used to create the storage for received elements
+   * @param mesh The repartitioned mesh
+   * @param old_local_elems The active elements this processor owned before the repartitioning
+   */
+  void redistribute(MaterialData & material_data,
+                    MooseMesh & mesh,
+                    const std::vector<const Elem *> & old_local_elems);
+
   /**
    * Swap (shallow copy) material properties in MaterialData and MaterialPropertyStorage
    * Thread safe
@@ -0,0 +1,90 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef DISTRIBUTEDEXODUSREADER_H
+#define DISTRIBUTEDEXODUSREADER_H
+
+// MOOSE includes
+#include "Moose.h" // using namespace libMesh
+
+// libMesh includes
+#include "libmesh/parallel_object.h"
+
+// libMesh forward declarations
+namespace libMesh
+{
+class DistributedMesh;
+}
+
+/**
+ * Reads an ExodusII file directly into a DistributedMesh without ever holding the whole mesh on
+ * one processor.
+ *
+ * Every processor reads a contiguous slice of the (block ordered) elements together with the node
+ * coordinates they reference using partial reads, links its slice to the neighboring slices,
+ * and then hands the mesh to the regular partitioner, which redistributes it. Peak memory per
+ * processor is therefore proportional to the slice size instead of the global mesh size.
+ *
+ * Only the mesh is read: nodal/elemental solution data, element attributes and the optional
+ * node/element number maps are ignored, and nodes and elements are numbered by their implicit
+ * position in the file.
+ */
+class DistributedExodusReader : public ParallelObject
+{
+public:
+  DistributedExodusReader(DistributedMesh & mesh);
+
+  /**
+   * Reads the file into the mesh passed to the constructor and prepares the mesh for use.
+   */
+  void read(const std::string & file_name);
+
+protected:
+  /// Reads the element slice owned by this processor and the nodes it references
+  void readLocalSlice();
+
+  /// Reads the side sets and node sets restricted to the local slice
+  void readBoundaries();
+
+  /// Marks sides shared with elements on other processors as remote and gathers those elements
+  void linkSlices();
+
+  /// Exchanges one vector per processor with every other processor
+  void exchange(std::vector<std::vector<dof_id_type>> & outgoing,
+                std::vector<std::vector<dof_id_type>> & incoming) const;
+
+  /// Reads the names of all the entities of the given exodus type (block, side set, node set)
+  std::vector<std::string> readNames(int entity_type, std::size_t n_entities) const;
+
+  /// The mesh being filled
+  DistributedMesh & _mesh;
+
+  /// The exodus file handle
+  int _ex_id;
+
+  /// Global sizes from the file header
+  int _num_dim;
+  dof_id_type _num_nodes;
+  dof_id_type _num_elem;
+
+  /// Element blocks, in file order
+  std::vector<int64_t> _block_ids;
+  std::vector<std::string> _block_types;
+  std::vector<dof_id_type> _block_sizes;
+  std::vector<int64_t> _block_nodes_per_elem;
+
+  /// Half open range of (0-based, block ordered) element ids read by this processor
+  dof_id_type _first_elem;
+  dof_id_type _end_elem;
+
+  /// The maximum number of node coordinates read per partial read
+  static const dof_id_type _coord_chunk_size;
+};
+
+#endif // DISTRIBUTEDEXODUSREADER_H
@@ -0,0 +1,88 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef MESHSTITCHER_H
+#define MESHSTITCHER_H
+
+// MOOSE includes
+#include "MooseTypes.h"
+
+// libMesh includes
+#include "libmesh/vector_value.h"
+
+// C++ includes
+#include <map>
+#include <set>
+
+// libMesh forward declarations
+namespace libMesh
+{
+class MeshBase;
+class BoundaryInfo;
+}
+
+/**
+ * Copies meshes into a replicated mesh and merges the coincident nodes on a pair of boundaries,
+ * like libMesh's stitch_meshes().
+ *
+ * The nodes on the boundary of the mesh being stitched into are binned in a hash grid with cells
+ * the size of the matching tolerance, so finding the node matching a node on the boundary of the
+ * other mesh only takes a look at the 27 cells around it. Stitching is therefore linear in the
+ * number of boundary nodes. The sides on the boundaries of the mesh are listed once, on the first
+ * stitch, and kept up to date as sides are copied in and merged, so the mesh must not be changed
+ * by other means while it is being stitched into. The mesh is not prepared for use afterwards, so
+ * several meshes can be stitched before preparing it once. Different stitchers may run
+ * concurrently on different meshes, e.g. to build the rows of a pattern in threads.
+ */
+class MeshStitcher
+{
+public:
+  /**
+   * @param mesh The mesh to stitch other meshes into
+   * @param tolerance The tolerance for merging nodes, relative to the smallest side on the
+   * stitched boundaries
+   */
+  MeshStitcher(MeshBase & mesh, Real tolerance = TOLERANCE);
+
+  /**
+   * Copies other, moved by translation, into the mesh and merges the nodes on other_boundary with
+   * the nodes on boundary in the mesh at the same location.
+   * @param clear_stitched_boundary_ids Whether to remove the boundary ids from the merged sides
+   */
+  void stitch(const MeshBase & other,
+              BoundaryID boundary,
+              BoundaryID other_boundary,
+              const RealVectorValue & translation = RealVectorValue(),
+              bool clear_stitched_boundary_ids = true);
+
+protected:
+  /// The sides (element id and side number) on a boundary
+  typedef std::vector<std::pair<dof_id_type, unsigned short int>> SideList;
+
+  /// Lists the sides of the mesh on every boundary from its boundary info
+  void buildBoundarySides();
+
+  /// Removes sides from the list of the sides of the mesh on boundary
+  void removeBoundarySides(BoundaryID boundary,
+                           const std::set<std::pair<dof_id_type, unsigned short int>> & removed);
+
+  /// The mesh that is being stitched into
+  MeshBase & _mesh;
+
+  /// The relative tolerance for merging nodes
+  const Real _tolerance;
+
+  /// The sides of the mesh on every boundary
+  std::map<BoundaryID, SideList> _boundary_sides;
+
+  /// Whether _boundary_sides has been built from the boundary info of the mesh
+  bool _boundary_sides_built;
+};
+
+#endif // MESHSTITCHER_H
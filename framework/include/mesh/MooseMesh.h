@@ -16,6 +16,7 @@
 #include "Restartable.h"
 #include "MooseEnum.h"
 #include "PerfGraphInterface.h"
+#include "CompressedSparseRow.h"
 
 #include <memory> //std::unique_ptr
 
@@ -149,13 +150,21 @@ public:
   const std::map<dof_id_type, std::vector<dof_id_type>> & nodeToElemMap();
 
   /**
-   * If not already created, creates a map from every node to all
+   * Flat (compressed-sparse-row) version of nodeToElemMap(). Prefer it in hot loops: the rows are
+   * stored back to back instead of in a tree. Only the nodes of the elements available on this
+   * processor get a row, and quadrature nodes added through addQuadratureNode() are not
+   * included; use the map version when those are needed.
+   */
+  const CompressedSparseRow<dof_id_type, dof_id_type> & nodeToElemCSR();
+
+  /**
+   * If not already created, creates a compressed-sparse-row structure from every node to all
    * _active_ _semilocal_ elements to which they are connected.
    * Semilocal elements include local elements and elements that share at least
    * one node with a local element.
-   * \note Extra ghosted elements are not included in this map!
+   * \note Extra ghosted elements and quadrature nodes are not included!
    */
-  const std::map<dof_id_type, std::vector<dof_id_type>> & nodeToActiveSemilocalElemMap();
+  const CompressedSparseRow<dof_id_type, dof_id_type> & nodeToActiveSemilocalElemCSR();
 
   /**
    * These structs are required so that the bndNodes{Begin,End} and
@@ -337,6 +346,22 @@ public:
   StoredRange<MooseMesh::const_bnd_node_iterator, const BndNode *> * getBoundaryNodeRange();
   StoredRange<MooseMesh::const_bnd_elem_iterator, const BndElement *> * getBoundaryElementRange();
 
+  /**
+   * Return the active local elements split into colors such that no two elements of the same
+   * color share a node. Threads working on a single color therefore never add into the same
+   * degree of freedom and may scatter into the global vectors and matrices without locking.
+   * Only elements whose nodes are all owned by this processor are colored; the rest are returned
+   * by getProcessorBoundaryActiveLocalElementRange(). The coloring is built on first use and
+   * rebuilt after the mesh changes.
+   */
+  const std::vector<std::unique_ptr<ConstElemRange>> & getColoredActiveLocalElementRanges();
+
+  /**
+   * Return the active local elements that touch a node owned by another processor. Contributions
+   * from these elements go through the PETSc off-processor stash and must be added with locking.
+   */
+  ConstElemRange * getProcessorBoundaryActiveLocalElementRange();
+
   /**
    * Returns a read-only reference to the set of subdomains currently
    * present in the Mesh.
@@ -919,9 +944,24 @@ protected:
   std::map<dof_id_type, std::vector<dof_id_type>> _node_to_elem_map;
   bool _node_to_elem_map_built;
 
-  /// A map of all of the current nodes to the active elements that they are connected to.
-  std::map<dof_id_type, std::vector<dof_id_type>> _node_to_active_semilocal_elem_map;
-  bool _node_to_active_semilocal_elem_map_built;
+  /// Flat version of the node to elem map above, see nodeToElemCSR()
+  CompressedSparseRow<dof_id_type, dof_id_type> _node_to_elem_csr;
+  bool _node_to_elem_csr_built;
+
+  /// The current nodes and the active semilocal elements they are connected to
+  CompressedSparseRow<dof_id_type, dof_id_type> _node_to_active_semilocal_elem_csr;
+  bool _node_to_active_semilocal_elem_csr_built;
+
+  /// Active local elements grouped by color, see getColoredActiveLocalElementRanges()
+  std::vector<std::vector<Elem *>> _colored_elems;
+  std::vector<std::unique_ptr<ConstElemRange>> _colored_elem_ranges;
+
+  /// Active local elements touching off-processor nodes, which are left uncolored
+  std::vector<Elem *> _processor_boundary_elems;
+  std::unique_ptr<ConstElemRange> _processor_boundary_elem_range;
+
+  /// Whether or not the element coloring is up to date with the mesh
+  bool _element_coloring_built;
 
   /**
    * A set of subdomain IDs currently present in the mesh. For parallel meshes, includes subdomains
@@ -949,13 +989,15 @@ protected:
   typedef std::vector<BndNode *>::const_iterator const_bnd_node_iterator_imp;
   /// Map of sets of node IDs in each boundary
   std::map<boundary_id_type, std::set<dof_id_type>> _bnd_node_ids;
+  /// Sorted boundary IDs of each local and ghosted boundary node, built from _bnd_node_ids
+  CompressedSparseRow<dof_id_type, boundary_id_type> _node_bnd_ids;
 
   /// array of boundary elems
   std::vector<BndElement *> _bnd_elems;
   typedef std::vector<BndElement *>::iterator bnd_elem_iterator_imp;
   typedef std::vector<BndElement *>::const_iterator const_bnd_elem_iterator_imp;
-  /// Map of set of elem IDs connected to each boundary
-  std::map<boundary_id_type, std::set<dof_id_type>> _bnd_elem_ids;
+  /// Sorted boundary IDs of each local and ghosted boundary element
+  CompressedSparseRow<dof_id_type, boundary_id_type> _elem_bnd_ids;
 
   std::map<dof_id_type, Node *> _quadrature_nodes;
   std::map<dof_id_type, std::map<unsigned int, std::map<dof_id_type, Node *>>>
@@ -1002,6 +1044,7 @@ protected:
   std::map<std::pair<BoundaryID, BoundaryID>, MortarInterface *> _mortar_interface_by_ids;
 
   void cacheInfo();
+  void buildElementColoring();
   void freeBndNodes();
   void freeBndElems();
 
@@ -1128,8 +1171,10 @@ private:
   PerfID _build_node_list_timer;
   PerfID _build_bnd_elem_list_timer;
   PerfID _node_to_elem_map_timer;
-  PerfID _node_to_active_semilocal_elem_map_timer;
+  PerfID _node_to_elem_csr_timer;
+  PerfID _node_to_active_semilocal_elem_csr_timer;
   PerfID _get_active_local_element_range_timer;
+  PerfID _build_element_coloring_timer;
   PerfID _get_active_node_range_timer;
   PerfID _get_local_node_range_timer;
   PerfID _get_boundary_node_range_timer;
@@ -45,6 +45,9 @@ public:
   virtual void buildMesh() override;
 
 protected:
+  /// Stitches the tiles in row i of the pattern into row_mesh
+  void buildRow(unsigned int i, ReplicatedMesh & row_mesh, BoundaryID right, BoundaryID left);
+
   // The mesh files to read
   const std::vector<MeshFileName> & _files;
 
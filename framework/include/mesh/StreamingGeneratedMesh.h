@@ -0,0 +1,104 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef STREAMINGGENERATEDMESH_H
+#define STREAMINGGENERATEDMESH_H
+
+#include "MooseMesh.h"
+
+#include <array>
+#include <functional>
+
+class StreamingGeneratedMesh;
+
+template <>
+InputParameters validParams<StreamingGeneratedMesh>();
+
+/**
+ * Builds a distributed brick of HEX8 or HEX27 elements directly from the (i, j, k) index space.
+ *
+ * The elements are ordered along a Morton curve through their indices and every processor owns a
+ * contiguous, equally sized piece of that order. The owner of any element follows from counting
+ * the elements before it on the curve, which only takes a walk down the octree of the index
+ * space, so every processor builds just its own elements and their point neighbors without any
+ * global map or communication. The cost of building the mesh therefore only depends on the
+ * number of local elements.
+ */
+class StreamingGeneratedMesh : public MooseMesh
+{
+public:
+  StreamingGeneratedMesh(const InputParameters & parameters);
+  StreamingGeneratedMesh(const StreamingGeneratedMesh & /* other_mesh */) = default;
+
+  // No copy
+  StreamingGeneratedMesh & operator=(const StreamingGeneratedMesh & other_mesh) = delete;
+
+  virtual std::unique_ptr<MooseMesh> safeClone() const override;
+
+  virtual void buildMesh() override;
+  virtual Real getMinInDimension(unsigned int component) const override;
+  virtual Real getMaxInDimension(unsigned int component) const override;
+
+protected:
+  typedef std::array<dof_id_type, 3> Index;
+
+  /// The number of elements before the element with the given indices along the Morton curve
+  dof_id_type curvePosition(const Index & ijk) const;
+
+  /// The processor owning the element with the given indices
+  processor_id_type elemOwner(const Index & ijk) const;
+
+  /// The processor owning the node with the given indices on the node grid
+  processor_id_type nodeOwner(const Index & node_ijk) const;
+
+  /**
+   * Calls visitor on the indices of the elements with curve positions in [begin, end) in curve
+   * order, descending only into the octants of the index space that contain some of them
+   */
+  void visitCurveRange(dof_id_type begin,
+                       dof_id_type end,
+                       const std::function<void(const Index &)> & visitor) const;
+
+  /// Recursive helper for visitCurveRange() on the cube at origin with the given side
+  void visitCurveRange(const Index & origin,
+                       dof_id_type side,
+                       dof_id_type & skip,
+                       dof_id_type & remaining,
+                       const std::function<void(const Index &)> & visitor) const;
+
+  /// Adds the element with the given indices and its nodes to the mesh
+  Elem * addElem(const Index & ijk, processor_id_type pid);
+
+  /// The number of elements in the part of the cube at origin with the given side inside the brick
+  dof_id_type countInBrick(const Index & origin, dof_id_type side) const;
+
+  /// The element id and its inverse
+  dof_id_type elemId(const Index & ijk) const;
+  Index elemIndices(dof_id_type id) const;
+
+  /// Number of elements in x, y, z direction
+  const Index _n;
+
+  /// The min/max values for x,y,z component
+  Real _xmin, _xmax, _ymin, _ymax, _zmin, _zmax;
+
+  /// The type of element to build
+  ElemType _elem_type;
+
+  /// The number of nodes along an element edge minus one: 1 for HEX8, 2 for HEX27
+  unsigned int _order;
+
+  /// The side of the smallest power of two cube containing the index space
+  dof_id_type _cube_side;
+
+  /// The total number of elements
+  const dof_id_type _n_elem;
+};
+
+#endif /* STREAMINGGENERATEDMESH_H */
@@ -29,6 +29,8 @@ class AddAllSideSetsByNormals : public AddSideSetsBase
 public:
   AddAllSideSetsByNormals(const InputParameters & parameters);
 
+  virtual unsigned int requiredMeshData() const override { return NEIGHBORS | MESH_CACHES; }
+
 protected:
   virtual void modify() override;
 
@@ -23,6 +23,8 @@ class AddExtraNodeset : public MeshModifier
 public:
   AddExtraNodeset(const InputParameters & params);
 
+  virtual unsigned int invalidatedMeshData() const override { return MESH_CACHES; }
+
 protected:
   virtual void modify() override;
 };
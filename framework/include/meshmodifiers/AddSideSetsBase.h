@@ -32,6 +32,9 @@ public:
   AddSideSetsBase(const InputParameters & parameters);
   virtual ~AddSideSetsBase(); // dtor required for unique_ptr with forward declarations
 
+  virtual unsigned int invalidatedMeshData() const override { return MESH_CACHES; }
+  virtual unsigned int requiredMeshData() const override { return NEIGHBORS; }
+
 protected:
   /**
    * This method is used to construct the FE object so we can compute
@@ -27,6 +27,8 @@ class AssignSubdomainID : public MeshModifier
 public:
   AssignSubdomainID(const InputParameters & parameters);
 
+  virtual unsigned int invalidatedMeshData() const override { return MESH_CACHES; }
+
 protected:
   virtual void modify() override;
 
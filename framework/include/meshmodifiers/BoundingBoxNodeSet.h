@@ -34,6 +34,8 @@ class BoundingBoxNodeSet : public MeshModifier
 public:
   BoundingBoxNodeSet(const InputParameters & parameters);
 
+  virtual unsigned int invalidatedMeshData() const override { return MESH_CACHES; }
+
 protected:
   virtual void modify() override;
 
@@ -22,7 +22,9 @@ class BreakBoundaryOnSubdomain : public MeshModifier
 public:
   BreakBoundaryOnSubdomain(const InputParameters & parameters);
 
-  virtual void modify();
+  virtual unsigned int invalidatedMeshData() const override { return MESH_CACHES; }
+
+  virtual void modify() override;
 };
 
 #endif /* BREAKBOUNDARYONSUBDOMAIN_H */
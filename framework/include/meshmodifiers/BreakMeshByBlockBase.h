@@ -23,6 +23,9 @@ class BreakMeshByBlockBase : public MeshModifier
 public:
   BreakMeshByBlockBase(const InputParameters & parameters);
 
+  /// Splitting the nodes disconnects the elements on either side of the interface
+  virtual unsigned int invalidatedMeshData() const override { return NEIGHBORS | MESH_CACHES; }
+
   // method to override to implement other mesh splitting algorithms
   virtual void modify() override;
 
@@ -29,6 +29,8 @@ class ElementDeleterBase : public MeshModifier
 public:
   ElementDeleterBase(const InputParameters & parameters);
 
+  virtual unsigned int requiredMeshData() const override { return NEIGHBORS; }
+
 protected:
   virtual void modify() override;
 
@@ -32,6 +32,8 @@ public:
    */
   ImageSubdomain(const InputParameters & parameters);
 
+  virtual unsigned int invalidatedMeshData() const override { return MESH_CACHES; }
+
 protected:
   virtual void modify() override;
 };
@@ -13,6 +13,11 @@
 #include "MooseObject.h"
 #include "Restartable.h"
 
+#include "libmesh/mesh_base.h"
+#include "libmesh/stored_range.h"
+
+#include <functional>
+
 // Forward declarations
 class MeshModifier;
 class MooseMesh;
@@ -26,6 +31,25 @@ InputParameters validParams<MeshModifier>();
 class MeshModifier : public MooseObject, public Restartable
 {
 public:
+  /**
+   * The mesh data structures a MeshModifier can leave stale or rely on. The modifiers are run as
+   * one pipeline that only rebuilds the stale data when a later modifier requires it, and rebuilds
+   * everything that is still stale once after the last modifier.
+   */
+  enum MeshData : unsigned int
+  {
+    NONE = 0,
+    /// The element neighbor links, rebuilt by libMesh's prepare_for_use()
+    NEIGHBORS = 1 << 0,
+    /// The element and node processor ids and ghosting, also rebuilt by prepare_for_use()
+    PARTITIONING = 1 << 1,
+    /// The subdomain and boundary id sets, node lists and dimension ranges cached by MooseMesh
+    MESH_CACHES = 1 << 2,
+    ALL = NEIGHBORS | PARTITIONING | MESH_CACHES
+  };
+
+  typedef StoredRange<MeshBase::element_iterator, Elem *> ElemRange;
+
   /**
    * Constructor
    *
@@ -36,8 +60,7 @@ public:
   /**
    * The base method called to trigger modification to the Mesh.
    * This method can trigger (re-)initialiation of the Mesh if
-   * necessary, modify the mesh through the virtual override, and
-   * also force prepare the mesh if requested.
+   * necessary and modify the mesh through the virtual override.
    */
   void modifyMesh(MooseMesh * mesh, MooseMesh * displaced_mesh);
 
@@ -46,6 +69,22 @@ public:
    */
   std::vector<std::string> & getDependencies() { return _depends_on; }
 
+  /**
+   * The MeshData this modifier leaves stale. The default is conservative, modifiers that only
+   * touch ids or names should override this.
+   */
+  virtual unsigned int invalidatedMeshData() const { return ALL; }
+
+  /**
+   * The MeshData that has to be up to date before this modifier runs.
+   */
+  virtual unsigned int requiredMeshData() const { return NONE; }
+
+  /**
+   * Whether the mesh should be fully prepared right after this modifier is run
+   */
+  bool forcePrepare() const { return _force_prepare; }
+
 protected:
   /**
    * This method is called _immediatly_ before modify to perform any necessary
@@ -65,6 +104,12 @@ protected:
    */
   void modifyMeshHelper(MooseMesh * mesh);
 
+  /**
+   * Calls fn on every active element of the mesh being modified, splitting the elements between
+   * the threads. fn must only change the element it is passed, e.g. its subdomain id.
+   */
+  void threadedActiveElementLoop(const std::function<void(Elem &)> & fn);
+
   /// Pointer to the mesh
   MooseMesh * _mesh_ptr;
 
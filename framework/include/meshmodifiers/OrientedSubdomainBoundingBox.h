@@ -34,6 +34,8 @@ public:
    */
   OrientedSubdomainBoundingBox(const InputParameters & parameters);
 
+  virtual unsigned int invalidatedMeshData() const override { return MESH_CACHES; }
+
 private:
   virtual void modify() override;
 
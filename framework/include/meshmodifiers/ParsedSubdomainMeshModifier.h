@@ -32,6 +32,8 @@ public:
    */
   ParsedSubdomainMeshModifier(const InputParameters & parameters);
 
+  virtual unsigned int invalidatedMeshData() const override { return MESH_CACHES; }
+
   virtual void modify() override;
 
 private:
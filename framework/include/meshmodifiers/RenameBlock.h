@@ -31,6 +31,8 @@ public:
    */
   RenameBlock(const InputParameters & parameters);
 
+  virtual unsigned int invalidatedMeshData() const override { return MESH_CACHES; }
+
 private:
   virtual void modify() override;
 
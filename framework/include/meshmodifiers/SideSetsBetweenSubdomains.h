@@ -22,6 +22,9 @@ class SideSetsBetweenSubdomains : public MeshModifier
 public:
   SideSetsBetweenSubdomains(const InputParameters & parameters);
 
+  virtual unsigned int invalidatedMeshData() const override { return MESH_CACHES; }
+  virtual unsigned int requiredMeshData() const override { return NEIGHBORS; }
+
 protected:
   virtual void modify() override;
 };
@@ -37,6 +37,8 @@ public:
    */
   SubdomainBoundingBox(const InputParameters & parameters);
 
+  virtual unsigned int invalidatedMeshData() const override { return MESH_CACHES; }
+
   virtual void modify() override;
 
 private:
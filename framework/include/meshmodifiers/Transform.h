@@ -25,6 +25,8 @@ class Transform : public MeshModifier
 public:
   Transform(const InputParameters & parameters);
 
+  virtual unsigned int invalidatedMeshData() const override { return MESH_CACHES; }
+
 protected:
   void modify() override;
 
@@ -301,6 +301,12 @@ protected:
    */
   void buildComm();
 
+  /**
+   * Assigns contiguous ranges of Apps with roughly the same total "app_costs" to the processors,
+   * every processor getting at least one App.  Only used with at least as many Apps as processors.
+   */
+  void assignAppsByCost();
+
   /**
    * Map a global App number to the local number.
    * Note: This will error if given a global number that doesn't map to a local number.
@@ -410,6 +416,15 @@ protected:
   /// Whether or not this processor as an App _at all_
   bool _has_an_app;
 
+  /// The relative cost of solving each App, used for assigning the Apps to processors
+  std::vector<Real> _app_costs;
+
+  /// Whether to print the time spent solving each App at the end of the run
+  const bool _report_app_costs;
+
+  /// The wall time spent solving each local App
+  std::vector<Real> _app_solve_times;
+
   /// Backups for each local App
   SubAppBackups & _backups;
 };
@@ -181,6 +181,11 @@ public:
    */
   const OutputOnWarehouse & advancedExecuteOn() const;
 
+  /**
+   * Returns true if the nodal or elemental variables will be written for the given type
+   */
+  virtual bool willOutputVariables(const ExecFlagType & type) override;
+
 protected:
   /**
    * Initialization method.
@@ -140,6 +140,13 @@ public:
    */
   virtual void outputStep(const ExecFlagType & type);
 
+  /**
+   * Returns true if a call to outputStep with the same type will write field variables. This is
+   * used to bring lazily evaluated auxiliary variables up to date only when they are needed.
+   * @param type The type execution flag (see Moose.h)
+   */
+  virtual bool willOutputVariables(const ExecFlagType & type);
+
 protected:
   /**
    * Overload this function with the desired output activities
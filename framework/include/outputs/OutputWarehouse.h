@@ -201,6 +201,13 @@ private:
    */
   void outputStep(ExecFlagType type);
 
+  /**
+   * Returns true if any output object will write field variables during the next call to
+   * outputStep with the given type.
+   * @param type The type execution flag (see Moose.h)
+   */
+  bool willOutputVariables(ExecFlagType type);
+
   ///@{
   /**
    * Ability to enable/disable output calls
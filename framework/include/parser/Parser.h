@@ -164,6 +164,12 @@ public:
 
   std::vector<std::string> listValidParams(std::string & section_name);
 
+  /**
+   * Renders a section of the input file, with the command line arguments merged in, or returns an
+   * empty string if the section is not present.
+   */
+  std::string renderSection(const std::string & section) const;
+
 protected:
   /**
    * Helper functions for setting parameters of arbitrary types - bodies are in the .C file
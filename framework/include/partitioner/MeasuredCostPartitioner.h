@@ -0,0 +1,64 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef MEASUREDCOSTPARTITIONER_H
+#define MEASUREDCOSTPARTITIONER_H
+
+// MOOSE includes
+#include "SpaceFillingCurvePartitioner.h"
+
+#include <unordered_map>
+
+class MeasuredCostPartitioner;
+class FEProblemBase;
+
+template <>
+InputParameters validParams<MeasuredCostPartitioner>();
+
+/**
+ * A SpaceFillingCurvePartitioner that weights the elements by the wall time the residual and
+ * material loops measured on them.
+ *
+ * When this partitioner is used, the FEProblemBase measures the element costs and checks the load
+ * imbalance after every time step. Once it exceeds "imbalance_tolerance" the mesh is
+ * repartitioned with the measured costs and the stateful material properties are moved to the
+ * new owners of their elements. Elements without a measurement (e.g. before the first solve)
+ * are weighted by the cost of their parent or by the average measured cost.
+ */
+class MeasuredCostPartitioner : public SpaceFillingCurvePartitioner
+{
+public:
+  MeasuredCostPartitioner(const InputParameters & params);
+
+  virtual std::unique_ptr<Partitioner> clone() const override;
+
+  virtual Real computeElementWeight(const Elem & elem) override;
+
+  virtual Real computeImbalance(const MeshBase & mesh) override;
+
+  /// Sets the problem that measures the element costs
+  void setProblem(FEProblemBase & fe_problem) { _fe_problem = &fe_problem; }
+
+protected:
+  virtual void _do_partition(MeshBase & mesh, const unsigned int n) override;
+
+  /// Fetches the measured costs and computes their average. Must be called on all processors.
+  void updateMeanCost(const MeshBase & mesh);
+
+  /// The problem measuring the element costs
+  FEProblemBase * _fe_problem;
+
+  /// The measured element costs, keyed by element id
+  const std::unordered_map<dof_id_type, Real> * _element_costs;
+
+  /// The average measured cost of an element over all processors
+  Real _mean_cost;
+};
+
+#endif /* MEASUREDCOSTPARTITIONER_H */
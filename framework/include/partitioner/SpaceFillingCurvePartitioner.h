@@ -0,0 +1,93 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef SPACEFILLINGCURVEPARTITIONER_H
+#define SPACEFILLINGCURVEPARTITIONER_H
+
+// MOOSE includes
+#include "MooseEnum.h"
+#include "MoosePartitioner.h"
+
+// C++ includes
+#include <array>
+#include <map>
+
+class SpaceFillingCurvePartitioner;
+
+template <>
+InputParameters validParams<SpaceFillingCurvePartitioner>();
+
+/**
+ * Partitions the mesh by ordering the active elements along a Hilbert or Morton curve through
+ * their centroids and cutting the curve into pieces of equal weight.
+ *
+ * The curve keys and the cut points are computed in parallel: every processor only sorts the keys
+ * of the elements it currently owns and the cuts are found by a global bisection on the key space,
+ * so no element data is gathered. Because the curve is fixed by the geometry, repartitioning an
+ * adapted mesh only moves the cut points and elements away from them keep their processor.
+ */
+class SpaceFillingCurvePartitioner : public MoosePartitioner
+{
+public:
+  SpaceFillingCurvePartitioner(const InputParameters & params);
+
+  virtual std::unique_ptr<Partitioner> clone() const override;
+
+  /**
+   * The relative cost of an element. The default implementation uses the "element_weight"
+   * parameter; derived classes can override this to supply e.g. measured costs.
+   */
+  virtual Real computeElementWeight(const Elem & elem);
+
+  /**
+   * The load imbalance of the current partitioning: the weight on the most loaded processor
+   * relative to the average weight per processor, minus one. Must be called on all processors.
+   */
+  virtual Real computeImbalance(const MeshBase & mesh);
+
+  /// The imbalance below which the current partitioning is kept
+  Real imbalanceTolerance() const { return _imbalance_tolerance; }
+
+  /// Computes the Hilbert index of a point with bits_per_dim bits of resolution per coordinate
+  static uint64_t hilbertKey(std::array<uint32_t, 3> x, unsigned int bits_per_dim);
+
+  /// Computes the Morton (Z-order) index of a point with bits_per_dim bits per coordinate
+  static uint64_t mortonKey(const std::array<uint32_t, 3> & x, unsigned int bits_per_dim);
+
+protected:
+  virtual void _do_partition(MeshBase & mesh, const unsigned int n) override;
+
+  /**
+   * Finds the n - 1 curve keys that split the globally distributed (sorted, local) keys into n
+   * pieces of equal weight.
+   */
+  std::vector<uint64_t> findCuts(const MeshBase & mesh,
+                                 const std::vector<std::pair<uint64_t, Real>> & sorted_keys,
+                                 const unsigned int n) const;
+
+  /// Which curve to order the elements along
+  const MooseEnum _curve;
+
+  /// How to weight the elements
+  const MooseEnum _element_weight;
+
+  /// Keep the current partitioning if its load imbalance is below this
+  const Real _imbalance_tolerance;
+
+  /// Whether or not this partitioner has partitioned the mesh before
+  bool _has_partitioned;
+
+  /// Number of quadrature points per element type for the qp count weight
+  std::map<ElemType, unsigned int> _n_qps;
+
+  /// Bits of resolution per coordinate, 3 * 21 bits fit in the 64 bit key
+  static const unsigned int _bits_per_dim = 21;
+};
+
+#endif /* SPACEFILLINGCURVEPARTITIONER_H */
@@ -16,6 +16,9 @@
 // Forward Declarations
 class ElementalVariableValue;
 class MooseMesh;
+template <typename>
+class MooseVariableFE;
+typedef MooseVariableFE<Real> MooseVariable;
 
 namespace libMesh
 {
@@ -37,6 +40,7 @@ public:
 protected:
   MooseMesh & _mesh;
   std::string _var_name;
+  MooseVariable & _var;
   Elem * _element;
 };
 
@@ -0,0 +1,44 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef JACOBIANREUSECOUNT_H
+#define JACOBIANREUSECOUNT_H
+
+#include "GeneralPostprocessor.h"
+
+// Forward Declarations
+class JacobianReuseCount;
+class JacobianReusePolicy;
+
+template <>
+InputParameters validParams<JacobianReuseCount>();
+
+/**
+ * Reports the total number of times the Jacobian was rebuilt or reused for a Newton step when
+ * Jacobian reuse is enabled in the Executioner
+ */
+class JacobianReuseCount : public GeneralPostprocessor
+{
+public:
+  JacobianReuseCount(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+  virtual void initialize() override {}
+  virtual void execute() override {}
+  virtual Real getValue() override;
+
+protected:
+  /// Which counter to report
+  const MooseEnum & _count;
+
+  /// The reuse policy of the nonlinear system
+  const JacobianReusePolicy * _policy;
+};
+
+#endif // JACOBIANREUSECOUNT_H
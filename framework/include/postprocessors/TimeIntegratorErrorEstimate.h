@@ -0,0 +1,46 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef TIMEINTEGRATORERRORESTIMATE_H
+#define TIMEINTEGRATORERRORESTIMATE_H
+
+#include "GeneralPostprocessor.h"
+
+class TimeIntegratorErrorEstimate;
+class TimeIntegrator;
+
+template <>
+InputParameters validParams<TimeIntegratorErrorEstimate>();
+
+/**
+ * Reports the scaled local truncation error estimate of the last time step, or -1 when the time
+ * integrator could not estimate it yet
+ */
+class TimeIntegratorErrorEstimate : public GeneralPostprocessor
+{
+public:
+  TimeIntegratorErrorEstimate(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+  virtual void initialize() override {}
+  virtual void execute() override {}
+  virtual Real getValue() override;
+
+protected:
+  /// The time integrator the error estimate comes from
+  TimeIntegrator * _time_integrator;
+
+  /// The absolute tolerance the error is scaled with
+  const Real _abs_tol;
+
+  /// The relative tolerance the error is scaled with
+  const Real _rel_tol;
+};
+
+#endif // TIMEINTEGRATORERRORESTIMATE_H
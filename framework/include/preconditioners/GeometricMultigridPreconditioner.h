@@ -0,0 +1,31 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef GEOMETRICMULTIGRIDPRECONDITIONER_H
+#define GEOMETRICMULTIGRIDPRECONDITIONER_H
+
+#include "SingleMatrixPreconditioner.h"
+
+class GeometricMultigridPreconditioner;
+
+template <>
+InputParameters validParams<GeometricMultigridPreconditioner>();
+
+/**
+ * Single matrix preconditioner solved with PETSc's PCMG, whose hierarchy of coarse grids comes from
+ * the refinement levels of the mesh through the DM of the nonlinear system.  The coarse operators
+ * are the Galerkin projections of the fine one.
+ */
+class GeometricMultigridPreconditioner : public SingleMatrixPreconditioner
+{
+public:
+  GeometricMultigridPreconditioner(const InputParameters & params);
+};
+
+#endif /* GEOMETRICMULTIGRIDPRECONDITIONER_H */
@@ -73,8 +73,25 @@ public:
   virtual void setup();
 
 protected:
+  /**
+   * Applies the preconditioner of a block to its right hand side the given number of times
+   */
+  void applyBlock(unsigned int system_var);
+
   /// The nonlinear system this PBP is associated with (convenience reference)
   NonlinearSystemBase & _nl;
+  /// Whether the blocks are solved independently (block Jacobi) instead of in sequence
+  const bool _additive;
+  /// Whether to reuse the blocks for the nonlinear iterations of a time step
+  const bool _reuse_blocks;
+  /// The number of preconditioner applications per block solve
+  const unsigned int _block_iterations;
+  /// Whether the blocks have been assembled for the current matrices
+  bool _blocks_current;
+  /// The time step the blocks were assembled in
+  int _blocks_t_step;
+  /// The time step size the blocks were assembled with
+  Real _blocks_dt;
   /// List of linear system that build up the preconditioner
   std::vector<LinearImplicitSystem *> _systems;
   /// Holds one Preconditioner object per small system to solve.
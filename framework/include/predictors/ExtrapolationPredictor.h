@@ -0,0 +1,60 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef EXTRAPOLATIONPREDICTOR_H
+#define EXTRAPOLATIONPREDICTOR_H
+
+// MOOSE includes
+#include "Predictor.h"
+
+// Forward declarations
+class ExtrapolationPredictor;
+
+template <>
+InputParameters validParams<ExtrapolationPredictor>();
+
+/**
+ * Predicts the solution with the polynomial through (or, if there are more solutions than
+ * coefficients, the least squares fit of) a number of previous solutions, which are kept in a
+ * ring buffer.
+ */
+class ExtrapolationPredictor : public Predictor
+{
+public:
+  ExtrapolationPredictor(const InputParameters & parameters);
+
+  virtual int order() override { return _order; }
+  virtual void timestepSetup() override;
+  virtual bool shouldApply() override;
+  virtual void apply(NumericVector<Number> & sln) override;
+
+protected:
+  /// The index of the k-th newest solution in the history
+  unsigned int historyIndex(unsigned int k) const;
+
+  /// The number of previous solutions to fit
+  const unsigned int _history_size;
+
+  /// The degree of the polynomial
+  const unsigned int _order;
+
+  /// The previous solutions
+  std::vector<NumericVector<Number> *> _history;
+
+  /// The times of the previous solutions
+  std::vector<Real> & _history_times;
+
+  /// The index of the newest solution in the history
+  unsigned int & _newest;
+
+  /// The number of solutions in the history
+  unsigned int & _n_stored;
+};
+
+#endif /* EXTRAPOLATIONPREDICTOR_H */
@@ -44,6 +44,12 @@ public:
 
   virtual NumericVector<Number> & solutionPredictor() { return _solution_predictor; }
 
+  /// Whether the prediction is rejected if its residual is larger than the unpredicted one
+  bool checkResidual() const { return _check_residual; }
+
+  /// Holds the unpredicted solution while the residual of the prediction is checked
+  NumericVector<Number> & unpredictedSolution() { return *_unpredicted_solution; }
+
 protected:
   FEProblemBase & _fe_problem;
   NonlinearSystemBase & _nl;
@@ -64,6 +70,12 @@ protected:
 
   /// Old times for which the predictor should not be applied
   std::vector<Real> _skip_times_old;
+
+  /// Whether to reject the prediction if its residual is larger than the unpredicted one
+  const bool _check_residual;
+
+  /// The unpredicted solution, only allocated if the residual is checked
+  NumericVector<Number> * _unpredicted_solution;
 };
 
 #endif /* PREDICTOR_H */
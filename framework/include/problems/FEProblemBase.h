@@ -74,6 +74,7 @@ class Sampler;
 class KernelBase;
 class IntegratedBCBase;
 class LineSearch;
+class MeasuredCostPartitioner;
 
 // libMesh forward declarations
 namespace libMesh
@@ -986,6 +987,21 @@ public:
    */
   virtual void computeResidual(const NumericVector<Number> & soln,
                                NumericVector<Number> & residual);
+  /**
+   * Exclude the objects that only fill the given vector tag from the residual evaluations of the
+   * nonlinear solve, they are only computed when the tag is explicitly asked for
+   */
+  void excludeVectorTagFromSolve(TagID tag) { _solve_excluded_vector_tags.insert(tag); }
+
+  /**
+   * Exclude the objects that only fill the given matrix tag from the Jacobian evaluations of the
+   * nonlinear solve, they are only computed when the tag is explicitly asked for
+   */
+  void excludeMatrixTagFromSolve(TagID tag) { _solve_excluded_matrix_tags.insert(tag); }
+
+  /// The matrix tags excluded from the Jacobian evaluations of the nonlinear solve
+  const std::set<TagID> & solveExcludedMatrixTags() const { return _solve_excluded_matrix_tags; }
+
   /**
    * Form a residual vector for a given tag
    */
@@ -1010,6 +1026,17 @@ public:
    */
   virtual void computeResidualTags(const std::set<TagID> & tags);
 
+  /**
+   * Form the residual of the nonlinear solve with only the given elements contributing to the
+   * element loop. Nothing but the residual objects is computed: the auxiliary kernels, user objects
+   * and transfers keep their values from the last full residual evaluation. The save-in variables
+   * are zeroed and only hold the contributions of the given elements afterwards. Used to finite
+   * difference the Jacobian.
+   */
+  void computeResidualOnElements(const NumericVector<Number> & soln,
+                                 NumericVector<Number> & residual,
+                                 const ConstElemRange & elems);
+
   /**
    * Form a Jacobian matrix. It is called by Libmesh.
    */
@@ -1248,6 +1275,38 @@ public:
   /// Update the mesh due to changing XFEM cuts
   virtual bool updateMeshXFEM();
 
+  /**
+   * Whether the element loops measure the time spent on each element. This is the case when the
+   * mesh is partitioned by a MeasuredCostPartitioner.
+   */
+  bool measureElementCost() const { return _measured_cost_partitioner != nullptr; }
+
+  /**
+   * Adds to the measured cost of an element
+   * @param elem The element the time was spent on
+   * @param cost The wall time in seconds
+   * @param tid The thread the time was spent on
+   */
+  void addElementCost(const Elem * elem, Real cost, THREAD_ID tid)
+  {
+    _element_costs[tid][elem->id()] += cost;
+  }
+
+  /**
+   * The measured cost of the local elements since the last rebalancing check, keyed by element
+   * id. Must not be called from within a threaded loop.
+   */
+  const std::unordered_map<dof_id_type, Real> & elementCosts();
+
+  /**
+   * Repartitions the mesh using the measured element costs when the measured load imbalance
+   * exceeds the tolerance of the MeasuredCostPartitioner. Stateful material properties move with
+   * their elements.
+   *
+   * @returns Whether or not the mesh was repartitioned
+   */
+  virtual bool rebalanceMesh();
+
   /**
    * Update data after a mesh change.
    */
@@ -1379,6 +1438,24 @@ public:
 
   void setIgnoreZerosInJacobian(bool state) { _ignore_zeros_in_jacobian = state; }
 
+  /**
+   * Whether residuals and Jacobians are assembled one element color at a time without locking.
+   * Neighbor contributions from DGKernels and InterfaceKernels can reach elements that do not
+   * share a node with the current one, so coloring is disabled when those are present. The
+   * nonlinear system also falls back to the locked assembly when it has constrained degrees of
+   * freedom.
+   */
+  bool coloredAssembly() const
+  {
+    return _colored_assembly && !_has_internal_edge_residual_objects;
+  }
+
+  /**
+   * Whether auxiliary variables that are not read by any object are only computed when they are
+   * about to be output or transferred.
+   */
+  bool lazyAuxiliaryVariables() const { return _lazy_auxiliary_variables; }
+
   /// Returns whether or not this Problem has a TimeIntegrator
   bool hasTimeIntegrator() const { return _has_time_integrator; }
 
@@ -1497,6 +1574,12 @@ protected:
 
   std::set<TagID> _fe_matrix_tags;
 
+  /// Vector tags not computed by the residual evaluations of the nonlinear solve
+  std::set<TagID> _solve_excluded_vector_tags;
+
+  /// Matrix tags not computed by the Jacobian evaluations of the nonlinear solve
+  std::set<TagID> _solve_excluded_matrix_tags;
+
   /// Whether or not to actually solve the nonlinear system
   bool _solve;
 
@@ -1669,6 +1752,12 @@ protected:
   /// Whether nor not stateful materials have been initialized
   bool _has_initialized_stateful;
 
+  /// The mesh partitioner when it balances the mesh by measured element costs
+  MeasuredCostPartitioner * _measured_cost_partitioner;
+
+  /// The measured element costs per thread, keyed by element id
+  std::vector<std::unordered_map<dof_id_type, Real>> _element_costs;
+
   /// Object responsible for restart (read/write)
   std::unique_ptr<Resurrector> _resurrector;
 
@@ -1732,6 +1821,8 @@ protected:
 private:
   bool _error_on_jacobian_nonzero_reallocation;
   bool _ignore_zeros_in_jacobian;
+  const bool _colored_assembly;
+  const bool _lazy_auxiliary_variables;
   const bool _force_restart;
   const bool _skip_additional_restart_data;
   const bool _skip_nl_system_check;
@@ -1782,6 +1873,7 @@ private:
   const PerfID _update_mesh_xfem_timer;
   const PerfID _mesh_changed_timer;
   const PerfID _mesh_changed_helper_timer;
+  const PerfID _rebalance_mesh_timer;
   const PerfID _check_problem_integrity_timer;
   const PerfID _serialize_solution_timer;
   const PerfID _check_nonlinear_convergence_timer;
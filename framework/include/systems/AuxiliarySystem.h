@@ -111,6 +111,22 @@ public:
    */
   virtual void compute(ExecFlagType type);
 
+  /**
+   * Compute the lazily evaluated auxiliary variables that were skipped by previous calls to
+   * compute(). This must be called on all processors, before anything reads the values of these
+   * variables from the solution vector (output, transfers, user objects) and before the solution
+   * is copied into the old states.
+   */
+  void computeLazyVars();
+
+  /**
+   * Record that the value of an auxiliary variable is read by an object, which prevents it from
+   * being lazily evaluated. Nothing proves that a lazy variable read after the initial setup is up
+   * to date, so all the variables are evaluated eagerly from the next compute() on.
+   * @param var_name The name of the variable being read
+   */
+  void markVariableRead(const std::string & var_name);
+
   /**
    * Get a list of dependent UserObjects for this exec type
    * @param type Execution flag type
@@ -163,8 +179,14 @@ public:
 
 protected:
   void computeScalarVars(ExecFlagType type);
-  void computeNodalVars(ExecFlagType type);
-  void computeElementalVars(ExecFlagType type);
+  void computeNodalVars(const MooseObjectWarehouse<AuxKernel> & nodal);
+  void computeElementalVars(const MooseObjectWarehouse<AuxKernel> & elemental);
+
+  /**
+   * Splits the AuxKernels into those that compute variables read by other objects and those that
+   * compute variables that are only written to output (lazy)
+   */
+  void setupLazyVars();
 
   FEProblemBase & _fe_problem;
 
@@ -197,10 +219,38 @@ protected:
   // Storage for AuxKernel objects
   ExecuteMooseObjectWarehouse<AuxKernel> _elemental_aux_storage;
 
+  /// True when the AuxKernels have been split into eager and lazy storage
+  bool _lazy_vars;
+
+  /// Names of the auxiliary variables read by objects other than the AuxKernels computing them
+  std::set<std::string> _read_variables;
+
+  /// Names of the auxiliary variables computed by lazy AuxKernels
+  std::set<std::string> _lazy_variables;
+
+  /// Set when a lazy variable is read after the initial setup, see markVariableRead()
+  bool _disable_lazy_vars;
+
+  ///@{
+  /// Storage for AuxKernel objects that are computed when compute() is called
+  ExecuteMooseObjectWarehouse<AuxKernel> _eager_nodal_aux_storage;
+  ExecuteMooseObjectWarehouse<AuxKernel> _eager_elemental_aux_storage;
+  ///@}
+
+  ///@{
+  /// Storage for AuxKernel objects that are only computed when their values are needed
+  ExecuteMooseObjectWarehouse<AuxKernel> _lazy_nodal_aux_storage;
+  ExecuteMooseObjectWarehouse<AuxKernel> _lazy_elemental_aux_storage;
+  ///@}
+
+  /// Execution flags with lazy AuxKernels that were skipped since the last computeLazyVars()
+  std::vector<ExecFlagType> _pending_lazy_flags;
+
   /// Timers
   PerfID _compute_scalar_vars_timer;
   PerfID _compute_nodal_vars_timer;
   PerfID _compute_elemental_vars_timer;
+  PerfID _compute_lazy_vars_timer;
 
   friend class AuxKernel;
   friend class ComputeNodalAuxVarsThread;
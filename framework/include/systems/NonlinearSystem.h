@@ -45,6 +45,23 @@ public:
 
   virtual void setupFiniteDifferencedPreconditioner() override;
 
+  /**
+   * Colors the columns of the Jacobian and sorts the degrees of freedom, the elements and the
+   * nonzeros by color for computeNativeColoringJacobian(). The Jacobian is assembled once with all
+   * the objects to get its nonzero pattern.
+   */
+  void setupNativeColoring();
+
+  /**
+   * Computes the Jacobian by finite differencing the residual color by color, evaluating the
+   * residual only on the elements that touch the degrees of freedom of the color being perturbed.
+   * The coloring must have been set up with setupNativeColoring().
+   * @param soln The solution to difference about
+   * @param jacobian The matrix to fill, it must have the sparsity pattern the coloring was built on
+   */
+  void computeNativeColoringJacobian(const NumericVector<Number> & soln,
+                                     SparseMatrix<Number> & jacobian);
+
   /**
    * Returns the convergence state
    * @return true if converged, otherwise false
@@ -76,6 +93,12 @@ protected:
   ComputeFDResidualFunctor _fd_residual_functor;
 
 private:
+  /**
+   * Verifies the Jacobians of the kernels, integrated boundary conditions, interface kernels and
+   * constraints one by one with the JacobianVerifier
+   */
+  void verifyJacobian();
+
   /**
    * Form preconditioning matrix via a standard finite difference method
    * column-by-column. This method computes both diagonal and off-diagonal
@@ -95,7 +118,36 @@ private:
    */
   void setupColoringFiniteDifferencedPreconditioner();
 
+  /**
+   * Colors the Jacobian like setupColoringFiniteDifferencedPreconditioner(), but differences the
+   * residual with MOOSE's own engine, see computeNativeColoringJacobian(), so that every
+   * perturbation only costs a residual evaluation on a small subset of the elements.
+   */
+  void setupNativeColoringFiniteDifferencedPreconditioner();
+
+#ifdef LIBMESH_HAVE_PETSC
+  /**
+   * Assembles the Jacobian once to get its nonzero pattern and colors its columns
+   */
+  void colorJacobianSparsity(ISColoring & iscoloring);
+#endif
+
   bool _use_coloring_finite_difference;
+
+  /// The locally owned degrees of freedom of every color
+  std::vector<std::vector<dof_id_type>> _fd_color_dofs;
+
+  /// The local elements the residual has to be evaluated on when perturbing every color
+  std::vector<std::vector<Elem *>> _fd_color_elems;
+
+  /// Ranges over _fd_color_elems
+  std::vector<std::unique_ptr<ConstElemRange>> _fd_color_elem_ranges;
+
+  /// The (row, column) pairs of the locally owned rows of the Jacobian, sorted by column color
+  std::vector<std::vector<std::pair<dof_id_type, dof_id_type>>> _fd_color_entries;
+
+  /// Timer for the native colored finite difference Jacobian
+  PerfID _native_fd_jacobian_timer;
 };
 
 #endif /* NONLINEARSYSTEM_H */
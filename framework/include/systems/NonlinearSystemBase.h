@@ -18,6 +18,7 @@
 
 #include "libmesh/transient_system.h"
 #include "libmesh/nonlinear_implicit_system.h"
+#include "libmesh/elem_range.h"
 
 // Forward declarations
 class FEProblemBase;
@@ -25,6 +26,8 @@ class MoosePreconditioner;
 class JacobianBlock;
 class TimeIntegrator;
 class Predictor;
+class JacobianReusePolicy;
+class JacobianVerifier;
 class ElementDamper;
 class NodalDamper;
 class GeneralDamper;
@@ -101,6 +104,10 @@ public:
     return _use_finite_differenced_preconditioner;
   }
   bool haveFieldSplitPreconditioner() const { return _use_field_split_preconditioner; }
+  bool haveGeometricMultigridPreconditioner() const
+  {
+    return _use_geometric_multigrid_preconditioner;
+  }
 
   /**
    * Returns the convergence state
@@ -248,6 +255,12 @@ public:
    */
   void computeResidualTags(const std::set<TagID> & tags);
 
+  /**
+   * Form multiple tag-associated residual vectors for all the given tags, with only the given
+   * elements contributing to the element loop
+   */
+  void computeResidualTags(const std::set<TagID> & tags, const ConstElemRange & elems);
+
   /**
    * Form a residual vector for a given tag
    */
@@ -404,6 +417,14 @@ public:
    */
   void useFieldSplitPreconditioner(bool use = true) { _use_field_split_preconditioner = use; }
 
+  /**
+   * If called with true this system will hand PETSc the multigrid hierarchy of its mesh.
+   */
+  void useGeometricMultigridPreconditioner(bool use = true)
+  {
+    _use_geometric_multigrid_preconditioner = use;
+  }
+
   /**
    * If called with true this will add entries into the jacobian to link together degrees of freedom
    * that are found to
@@ -491,6 +512,28 @@ public:
   void setPredictor(std::shared_ptr<Predictor> predictor);
   Predictor * getPredictor() { return _predictor.get(); }
 
+  /**
+   * Reuse the Jacobian and preconditioner across Newton iterations and time steps until the
+   * linear or nonlinear convergence degrades
+   * @param max_linear_its Rebuild when a linear solve takes more iterations than this
+   * @param max_contraction Rebuild when the ratio of successive nonlinear residual norms exceeds
+   * this
+   */
+  void setupJacobianReuse(unsigned int max_linear_its, Real max_contraction);
+
+  /**
+   * Verify the Jacobians of the objects one by one against finite differences before the first
+   * solve, see JacobianVerifier
+   * @param tolerance The relative error above which a Jacobian fails the verification
+   * @param error_on_failure Whether to stop with an error when any Jacobian fails
+   */
+  void setupJacobianVerification(Real tolerance, bool error_on_failure);
+
+  /**
+   * The Jacobian reuse policy, or nullptr if the Jacobian is rebuilt at every Newton step
+   */
+  JacobianReusePolicy * getJacobianReusePolicy() { return _jacobian_reuse_policy.get(); }
+
   TimeIntegrator * getTimeIntegrator() { return _time_integrator.get(); }
 
   void setPCSide(MooseEnum pcs);
@@ -536,6 +579,15 @@ public:
   {
     return _integrated_bcs;
   }
+  const MooseObjectTagWarehouse<NodalBCBase> & getNodalBCWarehouse() const { return _nodal_bcs; }
+  const MooseObjectWarehouse<NodalKernel> & getNodalKernelWarehouse() const
+  {
+    return _nodal_kernels;
+  }
+  const MooseObjectWarehouse<ScalarKernel> & getScalarKernelWarehouse() const
+  {
+    return _scalar_kernels;
+  }
   const MooseObjectWarehouse<ElementDamper> & getElementDamperWarehouse() const
   {
     return _element_dampers;
@@ -618,6 +670,15 @@ protected:
    */
   void computeJacobianInternal(const std::set<TagID> & tags);
 
+  /**
+   * Run the threaded element loop ThreadType over the active local elements, or over the elements
+   * the residual is restricted to. When colored assembly is enabled the loop runs one color at a
+   * time and the threads add their contributions without locking, the elements of a color sharing
+   * no degrees of freedom.
+   */
+  template <typename ThreadType>
+  void computeElementLoop(const std::set<TagID> & tags);
+
   void computeDiracContributions(bool is_jacobian);
 
   void computeScalarKernelsJacobians();
@@ -736,6 +797,8 @@ protected:
   std::string _decomposition_split;
   /// Whether or not to use a FieldSplitPreconditioner matrix based on the decomposition
   bool _use_field_split_preconditioner;
+  /// Whether or not to use a GeometricMultigridPreconditioner built from the mesh refinement levels
+  bool _use_geometric_multigrid_preconditioner;
 
   /// Whether or not to add implicit geometric couplings to the Jacobian for FDP
   bool _add_implicit_geometric_coupling_entries_to_jacobian;
@@ -756,6 +819,9 @@ protected:
   /// true if DG is active (optimization reasons)
   bool _doing_dg;
 
+  /// The elements the element loop of the residual is restricted to, nullptr for all of them
+  const ConstElemRange * _residual_elem_range;
+
   /// vectors that will be zeroed before a residual computation
   std::vector<std::string> _vecs_to_zero_for_residual;
 
@@ -770,6 +836,12 @@ protected:
   /// If predictor is active, this is non-NULL
   std::shared_ptr<Predictor> _predictor;
 
+  /// If Jacobian reuse is active, this is non-NULL
+  std::unique_ptr<JacobianReusePolicy> _jacobian_reuse_policy;
+
+  /// If the Jacobians are to be verified, this is non-NULL
+  std::unique_ptr<JacobianVerifier> _jacobian_verifier;
+
   bool _computing_initial_residual;
 
   bool _print_all_var_norms;
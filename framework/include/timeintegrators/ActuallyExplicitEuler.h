@@ -10,14 +10,10 @@
 #ifndef ACTUALLYEXPLICITEULER_H
 #define ACTUALLYEXPLICITEULER_H
 
-#include "TimeIntegrator.h"
-#include "MeshChangedInterface.h"
-
-#include "libmesh/linear_solver.h"
+#include "ExplicitTimeIntegrator.h"
 
 // Forward declarations
 class ActuallyExplicitEuler;
-class LumpedPreconditioner;
 
 template <>
 InputParameters validParams<ActuallyExplicitEuler>();
@@ -26,12 +22,11 @@ InputParameters validParams<ActuallyExplicitEuler>();
  * Implements a truly explicit (no nonlinear solve) first-order, forward Euler
  * time integration scheme.
  */
-class ActuallyExplicitEuler : public TimeIntegrator, public MeshChangedInterface
+class ActuallyExplicitEuler : public ExplicitTimeIntegrator
 {
 public:
   ActuallyExplicitEuler(const InputParameters & parameters);
 
-  virtual void initialSetup() override;
   virtual void init() override;
   virtual void preSolve() override;
   virtual int order() override { return 1; }
@@ -39,44 +34,13 @@ public:
   virtual void solve() override;
   virtual void postResidual(NumericVector<Number> & residual) override;
 
-  virtual void meshChanged() override;
-
 protected:
-  enum SolveType
-  {
-    CONSISTENT,
-    LUMPED,
-    LUMP_PRECONDITIONED
-  };
-
-  /**
-   * Check for the linear solver convergence
-   */
-  bool checkLinearConvergence();
-
-  MooseEnum _solve_type;
-
   /// Residual used for the RHS
   NumericVector<Real> & _explicit_residual;
 
   /// Solution vector for the linear solve
   NumericVector<Real> & _explicit_euler_update;
 
-  /// Diagonal of the lumped mass matrix (and its inversion)
-  NumericVector<Real> & _mass_matrix_diag;
-
-  /// Just a vector of 1's to help with creating the lumped mass matrix
-  NumericVector<Real> * _ones;
-
-  /// For computing the mass matrix
-  TagID _Ke_time_tag;
-
-  /// For solving with the consistent matrix
-  std::unique_ptr<LinearSolver<Number>> _linear_solver;
-
-  /// For solving with lumped preconditioning
-  std::unique_ptr<LumpedPreconditioner> _preconditioner;
-
   /// Save off current time to reset it back and forth
   Real _current_time;
 };
@@ -19,6 +19,9 @@ InputParameters validParams<BDF2>();
 
 /**
  * BDF2 time integrator
+ *
+ * The local truncation error is estimated with Milne's device, from the difference between the
+ * solution and the quadratic extrapolation of the three previous solutions.
  */
 class BDF2 : public TimeIntegrator
 {
@@ -29,9 +32,17 @@ public:
   virtual void preStep() override;
   virtual void computeTimeDerivatives() override;
   virtual void postResidual(NumericVector<Number> & residual) override;
+  virtual void postSolve() override;
+  virtual void postStep() override;
 
 protected:
   std::vector<Real> & _weight;
+
+  /// The solution before the older one, for the error estimate
+  NumericVector<Number> & _solution_oldest;
+
+  /// The size of the time step before the old one
+  Real & _dt_older;
 };
 
 #endif /* BDF2_H */
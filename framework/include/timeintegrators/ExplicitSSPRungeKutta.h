@@ -0,0 +1,100 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef EXPLICITSSPRUNGEKUTTA_H
+#define EXPLICITSSPRUNGEKUTTA_H
+
+#include "ExplicitTimeIntegrator.h"
+
+// Forward declarations
+class ExplicitSSPRungeKutta;
+
+template <>
+InputParameters validParams<ExplicitSSPRungeKutta>();
+
+/**
+ * Truly explicit (no nonlinear solve) strong-stability-preserving Runge-Kutta methods of first
+ * through fourth order, written in the Shu-Osher form
+ *
+ *   U^{(i)} = sum_{j < i} alpha_ij U^{(j)} + beta_ij dt M^{-1} F(t^n + c_j dt, U^{(j)})
+ *
+ * with U^{(0)} = U^n, so every stage is a combination of forward Euler steps that only costs a
+ * residual evaluation and a solve with the mass matrix.
+ *
+ *   Reference:
+ *   Gottlieb, S., Shu, C. W., & Tadmor, E. (2001).
+ *   Strong stability-preserving high-order time discretization methods.
+ *   SIAM review, 43(1), 89-112.
+ *
+ *   Spiteri, R. J., & Ruuth, S. J. (2002).
+ *   A new class of optimal high-order strong-stability-preserving time discretization methods.
+ *   SIAM Journal on Numerical Analysis, 40(2), 469-491.
+ */
+class ExplicitSSPRungeKutta : public ExplicitTimeIntegrator
+{
+public:
+  ExplicitSSPRungeKutta(const InputParameters & parameters);
+
+  virtual int order() override { return _order; }
+  virtual void computeTimeDerivatives() override;
+  virtual void solve() override;
+  virtual void postResidual(NumericVector<Number> & residual) override;
+
+protected:
+  /// The solution of stage j, U^{(0)} being the old solution
+  const NumericVector<Number> & stageSolution(unsigned int j) const;
+
+  /**
+   * Collects the local degrees of freedom the nodal boundary conditions apply to at the current
+   * stage solution
+   */
+  void findNodalBCDofs();
+
+  /**
+   * Sets the rows of the nodal boundary conditions to the forward Euler step from the start of
+   * the stage. Those rows of the update hold the boundary value minus the start of the stage, so
+   * the convex combination of the other stages would not reach the boundary value.
+   */
+  void enforceNodalBCs(NumericVector<Number> & next, unsigned int i);
+
+  /// The order of the method
+  const unsigned int _order;
+
+  /// The number of stages
+  unsigned int _n_stages;
+
+  /// The coefficients of the stage solutions
+  std::vector<std::vector<Real>> _alpha;
+
+  /// The coefficients of the stage updates
+  std::vector<std::vector<Real>> _beta;
+
+  /// The times of the stages as fractions of the time step
+  std::vector<Real> _c;
+
+  /// Residual used for the RHS
+  NumericVector<Real> & _explicit_residual;
+
+  /// The solutions of the stages after the first one
+  std::vector<NumericVector<Number> *> _stage_solutions;
+
+  /// The forward Euler updates computed in each stage
+  std::vector<NumericVector<Number> *> _stage_updates;
+
+  /// The solution the current stage starts from, the time derivative is taken relative to it
+  const NumericVector<Number> * _stage_start;
+
+  /// The time the boundary conditions of the current stage are applied at
+  Real _stage_end_time;
+
+  /// The local degrees of freedom the nodal boundary conditions apply to
+  std::vector<dof_id_type> _nodal_bc_dofs;
+};
+
+#endif // EXPLICITSSPRUNGEKUTTA_H
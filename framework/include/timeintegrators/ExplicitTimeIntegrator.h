@@ -0,0 +1,102 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef EXPLICITTIMEINTEGRATOR_H
+#define EXPLICITTIMEINTEGRATOR_H
+
+#include "TimeIntegrator.h"
+#include "MeshChangedInterface.h"
+
+#include "libmesh/linear_solver.h"
+
+// Forward declarations
+class ExplicitTimeIntegrator;
+class LumpedPreconditioner;
+
+namespace libMesh
+{
+template <typename T>
+class SparseMatrix;
+}
+
+template <>
+InputParameters validParams<ExplicitTimeIntegrator>();
+
+/**
+ * Base class for truly explicit (no nonlinear solve) time integrators: holds the mass matrix and
+ * solves with it, either with a linear solver or by inverting its lumped diagonal.
+ *
+ * The mass matrix is assembled with the TIME tag. When it does not depend on the solution or
+ * time it can be reused until the mesh or the time step size changes, in which case every step
+ * (or stage) only costs residual evaluations.
+ */
+class ExplicitTimeIntegrator : public TimeIntegrator, public MeshChangedInterface
+{
+public:
+  ExplicitTimeIntegrator(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+  virtual void meshChanged() override;
+
+protected:
+  enum SolveType
+  {
+    CONSISTENT,
+    LUMPED,
+    LUMP_PRECONDITIONED
+  };
+
+  /**
+   * Assembles the mass matrix at the given solution unless the one from a previous call can be
+   * reused, and lumps it if the solve type needs that
+   */
+  void updateMassMatrix(const NumericVector<Number> & soln);
+
+  /**
+   * Solves the mass matrix times update equals rhs
+   * @return Whether the solve converged
+   */
+  bool solveLinearSystem(NumericVector<Number> & update, NumericVector<Number> & rhs);
+
+  /// The system matrix, which holds the mass matrix
+  SparseMatrix<Number> & massMatrix();
+
+  /**
+   * Check for the linear solver convergence
+   */
+  bool checkLinearConvergence();
+
+  MooseEnum _solve_type;
+
+  /// Whether the mass matrix may be reused as long as the mesh and the time step size don't change
+  const bool _reuse_mass_matrix;
+
+  /// Diagonal of the lumped mass matrix (and its inversion)
+  NumericVector<Real> & _mass_matrix_diag;
+
+  /// Just a vector of 1's to help with creating the lumped mass matrix
+  NumericVector<Real> * _ones;
+
+  /// For computing the mass matrix
+  TagID _Ke_time_tag;
+
+  /// Whether the mass matrix has been assembled for the current mesh
+  bool _mass_matrix_current;
+
+  /// The time step size the mass matrix was assembled with
+  Real _mass_matrix_dt;
+
+  /// For solving with the consistent matrix
+  std::unique_ptr<LinearSolver<Number>> _linear_solver;
+
+  /// For solving with lumped preconditioning
+  std::unique_ptr<LumpedPreconditioner> _preconditioner;
+};
+
+#endif // EXPLICITTIMEINTEGRATOR_H
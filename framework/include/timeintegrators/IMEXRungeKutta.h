@@ -0,0 +1,95 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef IMEXRUNGEKUTTA_H
+#define IMEXRUNGEKUTTA_H
+
+#include "TimeIntegrator.h"
+
+// Forward declarations
+class IMEXRungeKutta;
+
+template <>
+InputParameters validParams<IMEXRungeKutta>();
+
+/**
+ * Implicit-explicit (additive) Runge-Kutta methods of first through third order. The objects that
+ * fill the EXPLICIT vector tag (instead of NONTIME) are integrated explicitly, all the others
+ * implicitly. The stage i solves
+ *
+ *   M (Y_i - y_n)/dt + sum_{j <= i} a_ij F_I(Y_j) + sum_{j < i} ahat_ij F_E(Y_j) = 0
+ *
+ * so the explicit residual F_E is evaluated once per stage and never enters the Jacobian, and
+ * the Newton solves only see the implicit operator F_I.
+ *
+ * The methods are the ones of Ascher, Ruuth and Spiteri: the IMEX Euler method ARS(1,1,1),
+ * ARS(2,2,2) and ARS(4,4,3). They are all stiffly accurate, so the solution of the last stage is
+ * the new solution, and have a first explicit stage, so F_I(y_n) is never needed.
+ *
+ *   Reference:
+ *   Ascher, U. M., Ruuth, S. J., & Spiteri, R. J. (1997).
+ *   Implicit-explicit Runge-Kutta methods for time-dependent partial differential equations.
+ *   Applied Numerical Mathematics, 25(2-3), 151-167.
+ */
+class IMEXRungeKutta : public TimeIntegrator
+{
+public:
+  IMEXRungeKutta(const InputParameters & parameters);
+
+  virtual void init() override;
+  virtual int order() override { return _order; }
+  virtual void computeTimeDerivatives() override;
+  virtual void solve() override;
+  virtual void postResidual(NumericVector<Number> & residual) override;
+
+protected:
+  /**
+   * Evaluates the explicit residual of the stage at the given solution and time
+   */
+  void computeExplicitResidual(unsigned int stage, const NumericVector<Number> & soln, Real time);
+
+  /**
+   * Errors if one of the objects fills only one of the explicit vector and matrix tags, or fills
+   * the system matrix along with the explicit vector tag
+   */
+  template <typename T>
+  void checkExplicitTags(const std::vector<std::shared_ptr<T>> & objects) const;
+
+  /// The order of the method
+  const unsigned int _order;
+
+  /// The number of stages, including the first (explicit) one
+  unsigned int _n_stages;
+
+  /// The coefficients of the implicit residuals of the stages
+  std::vector<std::vector<Real>> _a;
+
+  /// The coefficients of the explicit residuals of the stages
+  std::vector<std::vector<Real>> _a_hat;
+
+  /// The times of the stages as fractions of the time step
+  std::vector<Real> _c;
+
+  /// The vector tag the explicitly integrated objects fill
+  TagID _explicit_tag;
+
+  /// The matrix tag the explicitly integrated objects fill
+  TagID _explicit_matrix_tag;
+
+  /// The stage being solved, the last one outside of the solve
+  unsigned int _stage;
+
+  /// The implicit residuals of the stages after the first one
+  std::vector<NumericVector<Number> *> _implicit_residuals;
+
+  /// The explicit residuals of all the stages but the last one
+  std::vector<NumericVector<Number> *> _explicit_residuals;
+};
+
+#endif // IMEXRUNGEKUTTA_H
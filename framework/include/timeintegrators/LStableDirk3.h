@@ -42,6 +42,9 @@ InputParameters validParams<LStableDirk3>();
  * J. Numer. Anal., 14(6), Dec. 1977, pg. 1006-1021.  Unlike BDF3,
  * this method is L-stable and so may be more suitable for "stiff"
  * problems.
+ *
+ * The local truncation error is estimated with the embedded second
+ * order method that combines the first two stages only.
  */
 class LStableDirk3 : public TimeIntegrator
 {
@@ -73,6 +76,12 @@ protected:
   // 0.2820667392457705,  0.4358665215084589
   // 1.2084966491760099, -0.6443631706844688, 0.4358665215084589
   Real _a[3][3];
+
+  // The solutions of the first two stages, for the error estimate
+  std::vector<NumericVector<Number> *> _stage_solutions;
+
+  // The weights of the stage increments that give the error estimate
+  std::vector<Real> _error_weights;
 };
 
 #endif /* LSTABLEDIRK3_H */
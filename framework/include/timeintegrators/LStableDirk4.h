@@ -53,6 +53,9 @@ InputParameters validParams<LStableDirk4>();
  *
  * but its coefficients have less favorable "amplification factors"
  * than the present rule.
+ *
+ * The local truncation error is estimated with the embedded third
+ * order method that combines the first four stages only.
  */
 class LStableDirk4 : public TimeIntegrator
 {
@@ -83,6 +86,12 @@ protected:
   // Butcher tableau "A" values derived from _gamma.  We only use the
   // lower triangle of this.
   static const Real _a[_n_stages][_n_stages];
+
+  // The solutions of the first four stages, for the error estimate
+  std::vector<NumericVector<Number> *> _stage_solutions;
+
+  // The weights of the stage increments that give the error estimate
+  std::vector<Real> _error_weights;
 };
 
 #endif // LSTABLEDIRK4_H
@@ -110,7 +110,47 @@ public:
    */
   virtual unsigned int getNumLinearIterations() const { return _n_linear_iterations; }
 
+  /**
+   * Whether the time integrator estimates the local truncation error of its steps
+   */
+  bool supportsErrorEstimate() const { return _error_estimate; }
+
+  /**
+   * Whether the local truncation error of the last step was estimated, some integrators need
+   * a number of previous steps first
+   */
+  bool hasErrorEstimate() const { return _has_error_estimate; }
+
+  /**
+   * The power of the time step size the local truncation error estimate scales with
+   */
+  unsigned int errorEstimateOrder() const { return _error_estimate_order; }
+
+  /**
+   * The root mean square of the local truncation error estimate of the last step, with the
+   * error of every degree of freedom divided by abs_tol + rel_tol * |u|, so that one means the
+   * error is at the tolerance
+   */
+  Real scaledErrorEstimate(Real abs_tol, Real rel_tol) const;
+
 protected:
+  /**
+   * The weights w_j of the stage increments Y_j - y_n that give the difference between the
+   * solution of a stiffly accurate DIRK method with the Butcher tableau (a, c) and the solution of
+   * an embedded method of the given order (2 or 3) that reuses the stages but the last one
+   */
+  static std::vector<Real> embeddedErrorWeights(const std::vector<std::vector<Real>> & a,
+                                                const std::vector<Real> & c,
+                                                unsigned int order);
+
+  /**
+   * Sets the error estimate to sum_j w_j (Y_j - y_n), the last stage being the current solution
+   * @param stage_solutions The solutions of the stages but the last one
+   * @param weights The weights from embeddedErrorWeights()
+   */
+  void computeEmbeddedErrorEstimate(const std::vector<NumericVector<Number> *> & stage_solutions,
+                                    const std::vector<Real> & weights);
+
   /**
    * Gets the number of nonlinear iterations in the most recent solve.
    */
@@ -151,6 +191,15 @@ protected:
   unsigned int _n_nonlinear_iterations;
   /// Total number of linear iterations over all stages of the time step
   unsigned int _n_linear_iterations;
+
+  /// The local truncation error estimate, nullptr if the time integrator does not estimate it
+  NumericVector<Number> * _error_estimate;
+
+  /// Whether the error of the last step was estimated
+  bool _has_error_estimate;
+
+  /// The power of the time step size the error estimate scales with
+  unsigned int _error_estimate_order;
 };
 
 #endif /* TIMEINTEGRATOR_H */
@@ -0,0 +1,81 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef ERRORADAPTIVEDT_H
+#define ERRORADAPTIVEDT_H
+
+#include "TimeStepper.h"
+
+class ErrorAdaptiveDT;
+class TimeIntegrator;
+
+template <>
+InputParameters validParams<ErrorAdaptiveDT>();
+
+/**
+ * Chooses the time step size from the local truncation error estimate of the time integrator
+ * with a PI controller, and rejects the steps whose error exceeds the tolerance.
+ *
+ *   Reference:
+ *   Hairer, E., & Wanner, G. (1996).
+ *   Solving Ordinary Differential Equations II: Stiff and Differential-Algebraic Problems,
+ *   Section IV.8. Springer.
+ */
+class ErrorAdaptiveDT : public TimeStepper
+{
+public:
+  ErrorAdaptiveDT(const InputParameters & parameters);
+
+  virtual void init() override;
+  virtual void step() override;
+  virtual bool converged() override;
+
+protected:
+  virtual Real computeInitialDT() override;
+  virtual Real computeDT() override;
+  virtual Real computeFailedDT() override;
+
+  /// Limits the factor the time step size changes by to the allowed range
+  Real limitFactor(Real factor) const;
+
+  /// The time integrator the error estimate comes from
+  TimeIntegrator * _time_integrator;
+
+  /// The absolute tolerance of the error
+  const Real _abs_tol;
+
+  /// The relative tolerance of the error
+  const Real _rel_tol;
+
+  /// The safety factor the ideal time step size is multiplied by
+  const Real _safety_factor;
+
+  /// The largest factor the time step size may grow by
+  const Real _max_increase;
+
+  /// The smallest factor the time step size may be cut by
+  const Real _max_decrease;
+
+  /// The integral gain of the controller
+  const Real _integral_gain;
+
+  /// The proportional gain of the controller
+  const Real _proportional_gain;
+
+  /// The scaled error of the last step, negative if it could not be estimated
+  Real _error;
+
+  /// The scaled error of the last accepted step
+  Real & _error_old;
+
+  /// Whether the last step was rejected because of its error
+  bool _error_rejected;
+};
+
+#endif /* ERRORADAPTIVEDT_H */
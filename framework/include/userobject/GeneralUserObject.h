@@ -72,9 +72,38 @@ public:
 
   ///@}
 
+  ///@{
+  /**
+   * Store dependencies on other UserObjects so that independent objects can be identified
+   */
+  template <typename T>
+  const T & getUserObject(const std::string & name);
+  template <typename T>
+  const T & getUserObjectByName(const UserObjectName & name);
+
+  const UserObject & getUserObjectBase(const std::string & name);
+  const UserObject & getUserObjectBaseByName(const UserObjectName & name);
+  ///@}
+
 protected:
   std::set<std::string> _depend_vars;
   std::set<std::string> _supplied_vars;
 };
 
+template <typename T>
+const T &
+GeneralUserObject::getUserObject(const std::string & name)
+{
+  _depend_vars.insert(_pars.get<UserObjectName>(name));
+  return UserObjectInterface::getUserObject<T>(name);
+}
+
+template <typename T>
+const T &
+GeneralUserObject::getUserObjectByName(const UserObjectName & name)
+{
+  _depend_vars.insert(name);
+  return UserObjectInterface::getUserObjectByName<T>(name);
+}
+
 #endif
@@ -0,0 +1,204 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef COMPRESSEDSPARSEROW_H
+#define COMPRESSEDSPARSEROW_H
+
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ * Flat compressed-sparse-row storage for a one-to-many relation keyed by an integer id
+ * (node id -> element ids, node id -> boundary ids, ...).
+ *
+ * Only the ids that have entries get a row, so on a distributed mesh the storage is proportional
+ * to the local and ghosted entries rather than to the global id range. All values live in a
+ * single contiguous array and the i-th stored id occupies [_offsets[i], _offsets[i + 1]). A
+ * lookup indexes the rows directly when the stored ids are contiguous and does a binary search
+ * over them otherwise.
+ */
+template <typename Key, typename T>
+class CompressedSparseRow
+{
+public:
+  /**
+   * Read-only view of a single row.
+   */
+  class Row
+  {
+  public:
+    Row(const T * begin, const T * end) : _begin(begin), _end(end) {}
+
+    const T * begin() const { return _begin; }
+    const T * end() const { return _end; }
+    std::size_t size() const { return _end - _begin; }
+    bool empty() const { return _begin == _end; }
+    const T & operator[](std::size_t i) const { return _begin[i]; }
+
+  private:
+    const T * _begin;
+    const T * _end;
+  };
+
+  /// The (id, value) pairs a structure is built from
+  typedef std::vector<std::pair<Key, T>> Entries;
+
+  CompressedSparseRow() : _offsets(1, 0), _contiguous(true) {}
+
+  /**
+   * Builds the structure from a list of (id, value) entries with a counting pass, a prefix sum
+   * over the counts and a filling pass. When the ids are spread out over a range much wider than
+   * the number of entries, only the distinct ids are sorted.
+   *
+   * @param entries The entries, in any order
+   * @param sort_unique Whether to sort the values of each row and remove duplicates, otherwise
+   *                    the values keep their order in entries
+   */
+  void build(const Entries & entries, bool sort_unique)
+  {
+    clear();
+    if (entries.empty())
+      return;
+
+    Key min_id = entries.front().first;
+    Key max_id = min_id;
+    for (const auto & entry : entries)
+    {
+      min_id = std::min(min_id, entry.first);
+      max_id = std::max(max_id, entry.first);
+    }
+
+    // The row of each entry
+    std::vector<std::size_t> rows(entries.size());
+    if (static_cast<std::size_t>(max_id - min_id) < entries.size())
+    {
+      // Flag the ids in the range that have entries and number them in order
+      std::vector<std::size_t> slots(static_cast<std::size_t>(max_id - min_id) + 1, 0);
+      for (const auto & entry : entries)
+        slots[entry.first - min_id] = 1;
+      for (std::size_t i = 0; i < slots.size(); ++i)
+        if (slots[i])
+        {
+          slots[i] = _keys.size();
+          _keys.push_back(min_id + i);
+        }
+      for (std::size_t i = 0; i < entries.size(); ++i)
+        rows[i] = slots[entries[i].first - min_id];
+    }
+    else
+    {
+      std::unordered_map<Key, std::size_t> slots;
+      for (const auto & entry : entries)
+        if (slots.emplace(entry.first, 0).second)
+          _keys.push_back(entry.first);
+      std::sort(_keys.begin(), _keys.end());
+      for (std::size_t i = 0; i < _keys.size(); ++i)
+        slots[_keys[i]] = i;
+      for (std::size_t i = 0; i < entries.size(); ++i)
+        rows[i] = slots[entries[i].first];
+    }
+
+    _offsets.assign(_keys.size() + 1, 0);
+    for (const auto row : rows)
+      _offsets[row + 1]++;
+    std::partial_sum(_offsets.begin(), _offsets.end(), _offsets.begin());
+
+    // Filling in the order of entries keeps that order within each row
+    std::vector<std::size_t> next(_offsets.begin(), _offsets.end() - 1);
+    _values.resize(entries.size());
+    for (std::size_t i = 0; i < entries.size(); ++i)
+      _values[next[rows[i]]++] = entries[i].second;
+
+    if (sort_unique)
+    {
+      // The rows are short, sort each one and shift it down over the removed duplicates
+      std::size_t n_values = 0;
+      for (std::size_t i = 0; i < _keys.size(); ++i)
+      {
+        const auto begin = _values.begin() + _offsets[i];
+        auto end = _values.begin() + _offsets[i + 1];
+        std::sort(begin, end);
+        end = std::unique(begin, end);
+
+        _offsets[i] = n_values;
+        n_values = std::move(begin, end, _values.begin() + n_values) - _values.begin();
+      }
+      _offsets.back() = n_values;
+      _values.resize(n_values);
+    }
+
+    _contiguous = static_cast<std::size_t>(_keys.back() - _keys.front()) + 1 == _keys.size();
+  }
+
+  /// Removes all rows and values
+  void clear()
+  {
+    _keys.clear();
+    _offsets.assign(1, 0);
+    _values.clear();
+    _contiguous = true;
+  }
+
+  /// The number of stored rows
+  std::size_t numRows() const { return _keys.size(); }
+
+  /// The total number of stored values
+  std::size_t numEntries() const { return _values.size(); }
+
+  /// Whether or not id has a row
+  bool hasRow(Key id) const { return index(id) != _keys.size(); }
+
+  /// The values of id; an empty row is returned for ids without entries
+  Row row(Key id) const
+  {
+    const auto i = index(id);
+    if (i == _keys.size())
+      return Row(nullptr, nullptr);
+    return Row(_values.data() + _offsets[i], _values.data() + _offsets[i + 1]);
+  }
+
+  /// Binary search for value in the row of id, only valid for a structure built with sort_unique
+  bool contains(Key id, const T & value) const
+  {
+    const auto r = row(id);
+    return std::binary_search(r.begin(), r.end(), value);
+  }
+
+private:
+  /// The position of id in _keys, or the number of keys when id has no row
+  std::size_t index(Key id) const
+  {
+    if (_keys.empty() || id < _keys.front() || id > _keys.back())
+      return _keys.size();
+
+    if (_contiguous)
+      return id - _keys.front();
+
+    const auto it = std::lower_bound(_keys.begin(), _keys.end(), id);
+    return *it == id ? it - _keys.begin() : _keys.size();
+  }
+
+  /// The sorted ids that have a row
+  std::vector<Key> _keys;
+
+  /// Start of each row in _values, with a trailing entry holding the total size
+  std::vector<std::size_t> _offsets;
+
+  /// The row values, stored back to back
+  std::vector<T> _values;
+
+  /// Whether the ids in _keys have no gaps, so that rows can be indexed directly
+  bool _contiguous;
+};
+
+#endif // COMPRESSEDSPARSEROW_H
@@ -167,6 +167,9 @@ private:
   /// the Control object.
   friend class Control;
 
+  /// The Jacobian verification enables the objects contributing to the residual one at a time
+  friend class JacobianVerifier;
+
   // Allow unit test to call methods
   FRIEND_TEST(InputParameterWarehouse, getControllableItems);
   FRIEND_TEST(InputParameterWarehouse, getControllableParameter);
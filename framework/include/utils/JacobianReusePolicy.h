@@ -0,0 +1,104 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef JACOBIANREUSEPOLICY_H
+#define JACOBIANREUSEPOLICY_H
+
+// MOOSE includes
+#include "Moose.h" // using namespace libMesh
+
+/**
+ * Decides when the Jacobian and preconditioner must be rebuilt during a sequence of nonlinear
+ * solves. The previous Jacobian is reused across Newton iterations and time steps until the
+ * linear solver needs too many iterations or the nonlinear residual stops contracting fast enough.
+ */
+class JacobianReusePolicy
+{
+public:
+  /**
+   * @param max_linear_its Rebuild when the previous linear solve took more iterations than this
+   * @param max_contraction Rebuild when the ratio of successive nonlinear residual norms exceeds this
+   */
+  JacobianReusePolicy(unsigned int max_linear_its, Real max_contraction);
+
+  /**
+   * Called before each nonlinear solve. A change in the time step size alters the time derivative
+   * contributions to the Jacobian, which forces a rebuild.
+   */
+  void solveSetup(Real dt);
+
+  /**
+   * Called after each nonlinear solve. Reusing a Jacobian that led to a failed solve would likely
+   * fail again, so a rebuild is forced.
+   */
+  void solveFinished(bool converged);
+
+  /**
+   * Called from the linear convergence check to record the iteration count of the linear solve
+   */
+  void linearIteration(unsigned int n) { _linear_its = n; }
+
+  /**
+   * Called from the nonlinear convergence check when another Newton step will be taken.
+   * @param it The current nonlinear iteration
+   * @param fnorm The current nonlinear residual norm
+   * @return True if the Jacobian must be rebuilt before the next Newton step
+   */
+  bool checkIteration(unsigned int it, Real fnorm);
+
+  /**
+   * Called from the Jacobian callback every time the Jacobian is assembled
+   */
+  void jacobianRebuilt();
+
+  /**
+   * Force a rebuild before the next Newton step (e.g., when the mesh changed)
+   */
+  void requestRebuild() { _rebuild = true; }
+
+  /**
+   * Whether the Jacobian will be rebuilt before the next Newton step
+   */
+  bool rebuildRequested() const { return _rebuild; }
+
+  ///@{
+  /**
+   * The number of times the Jacobian was assembled or reused for a Newton step
+   */
+  unsigned int numRebuilds() const { return _num_rebuilds; }
+  unsigned int numReuses() const { return _num_reuses; }
+  ///@}
+
+protected:
+  /// Linear iteration count above which the Jacobian is rebuilt
+  const unsigned int _max_linear_its;
+
+  /// Ratio of successive nonlinear residual norms above which the Jacobian is rebuilt
+  const Real _max_contraction;
+
+  /// Whether the Jacobian will be rebuilt before the next Newton step
+  bool _rebuild;
+
+  /// The nonlinear residual norm at the previous iteration
+  Real _last_fnorm;
+
+  /// The number of iterations of the most recent linear solve
+  unsigned int _linear_its;
+
+  /// The time step size of the previous nonlinear solve
+  Real _last_dt;
+
+  ///@{
+  /// Counters
+  unsigned int _num_rebuilds;
+  unsigned int _num_reuses;
+  ///@}
+};
+
+#endif // JACOBIANREUSEPOLICY_H
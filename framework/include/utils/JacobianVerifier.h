@@ -0,0 +1,85 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef JACOBIANVERIFIER_H
+#define JACOBIANVERIFIER_H
+
+// MOOSE includes
+#include "PerfGraphInterface.h"
+#include "ConsoleStream.h"
+
+// Forward declarations
+class FEProblemBase;
+class NonlinearSystem;
+class MooseObject;
+class InputParameterWarehouse;
+
+/**
+ * Checks the hand coded Jacobians object by object. Every object is enabled on its own, all the
+ * other objects contributing to the residual being disabled, and its Jacobian is compared with a
+ * colored finite difference of its residual. The relative errors and the times needed to assemble
+ * the Jacobian and the residual of every object are reported in a table, and the assembly times
+ * are added to the perf graph.
+ */
+class JacobianVerifier : public PerfGraphInterface
+{
+public:
+  /**
+   * @param fe_problem The problem whose Jacobians are verified
+   * @param tolerance The relative error above which a Jacobian fails the verification
+   * @param error_on_failure Whether to stop with an error when any Jacobian fails the verification
+   */
+  JacobianVerifier(FEProblemBase & fe_problem, Real tolerance, bool error_on_failure);
+
+  /**
+   * Verifies the Jacobians at the current solution of the nonlinear system
+   * @param nl The nonlinear system
+   * @param objects The objects to verify
+   * @param contributors All the objects contributing to the residual, which are disabled while
+   * verifying the others
+   */
+  void verify(NonlinearSystem & nl,
+              const std::vector<MooseObject *> & objects,
+              const std::vector<MooseObject *> & contributors);
+
+  /**
+   * Whether the Jacobians have been verified already
+   */
+  bool verified() const { return _verified; }
+
+protected:
+  /**
+   * Enables or disables an object through its controllable "enable" parameter, the active objects
+   * have to be updated afterwards
+   */
+  void setEnabled(const MooseObject & object, bool enabled);
+
+  /// The problem whose Jacobians are verified
+  FEProblemBase & _fe_problem;
+
+  /// For toggling the objects on and off
+  InputParameterWarehouse & _input_parameter_warehouse;
+
+  /// For printing the report
+  const ConsoleStream _console;
+
+  /// The relative error above which a Jacobian fails the verification
+  const Real _tolerance;
+
+  /// Whether to stop with an error when any Jacobian fails the verification
+  const bool _error_on_failure;
+
+  /// Whether the Jacobians have been verified already
+  bool _verified;
+
+  /// Timer for the whole verification
+  PerfID _verify_timer;
+};
+
+#endif // JACOBIANVERIFIER_H
@@ -0,0 +1,36 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef MEASUREDCOSTPARTITIONERTEST_H
+#define MEASUREDCOSTPARTITIONERTEST_H
+
+// MOOSE includes
+#include "MeasuredCostPartitioner.h"
+
+class MeasuredCostPartitionerTest;
+
+template <>
+InputParameters validParams<MeasuredCostPartitionerTest>();
+
+/**
+ * Replaces the measured wall times with fixed costs so the rebalancing does not depend on timing:
+ * the elements are equally expensive until the first time step, after which the lower left
+ * quadrant of the unit square becomes ten times as expensive.
+ */
+class MeasuredCostPartitionerTest : public MeasuredCostPartitioner
+{
+public:
+  MeasuredCostPartitionerTest(const InputParameters & params);
+
+  virtual std::unique_ptr<Partitioner> clone() const override;
+
+  virtual Real computeElementWeight(const Elem & elem) override;
+};
+
+#endif /* MEASUREDCOSTPARTITIONERTEST_H */
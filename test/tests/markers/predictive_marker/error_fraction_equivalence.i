@@ -0,0 +1,65 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 20
+  ny = 4
+  ymax = 0.2
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./time]
+    type = TimeDerivative
+    variable = u
+  [../]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+  [./conv]
+    type = Convection
+    variable = u
+    velocity = '5 0 0'
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 1
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 8
+  dt = 0.02
+  solve_type = PJFNK
+[]
+
+[Adaptivity]
+  [./Indicators]
+    [./jump]
+      type = GradientJumpIndicator
+      variable = u
+    [../]
+  [../]
+  [./Markers]
+    [./marker]
+      type = ErrorFractionMarker
+      indicator = jump
+      refine = 0.5
+      coarsen = 0.1
+    [../]
+  [../]
+[]
+
+[Outputs]
+  exodus = true
+[]
@@ -0,0 +1,79 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 10
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Functions]
+  # The squared error of element k is 0.1 * (t - k) once t > k, so the error front moves right by
+  # one element every time step
+  [./front]
+    type = ParsedFunction
+    value = 'sqrt(max(0, t - floor(10 * x)))'
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[BCs]
+  [./all]
+    type = DirichletBC
+    variable = u
+    boundary = 'left right'
+    value = 0
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 3
+  dt = 1
+  solve_type = NEWTON
+[]
+
+[Adaptivity]
+  [./Indicators]
+    [./error]
+      type = AnalyticalIndicator
+      variable = u
+      function = front
+    [../]
+  [../]
+  [./Markers]
+    [./marker]
+      type = PredictiveMarker
+      indicator = error
+      refine = 0.45
+      coarsen = 0.1
+      lookahead = 1
+      buffer_layers = 1
+      coarsen_delay = 2
+    [../]
+  [../]
+[]
+
+[VectorPostprocessors]
+  # The markers are computed after the postprocessors of a time step, so they are sampled at the
+  # beginning of the next one
+  [./markers]
+    type = ElementValueSampler
+    variable = marker
+    sort_by = id
+    execute_on = timestep_begin
+  [../]
+[]
+
+[Outputs]
+  csv = true
+  execute_on = timestep_end
+[]
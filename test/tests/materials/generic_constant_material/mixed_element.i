@@ -0,0 +1,84 @@
+# Two TRI3 and a QUAD4 in the same subdomain, the elements have different
+# numbers of quadrature points
+[Mesh]
+  file = ../../kernels/anisotropic_diffusion/mixed_block.e
+[]
+
+[MeshModifiers]
+  [./one_block]
+    type = SubdomainBoundingBox
+    bottom_left = '-100 -100 0'
+    top_right = '100 100 0'
+    block_id = 1
+  [../]
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./prop]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = DiffMKernel
+    variable = u
+    mat_prop = diff1
+  [../]
+[]
+
+[AuxKernels]
+  [./prop]
+    type = MaterialRealAux
+    variable = prop
+    property = diff1
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = 1
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = 3
+    value = 1
+  [../]
+[]
+
+[Materials]
+  [./dm1]
+    type = GenericConstantMaterial
+    prop_names = 'diff1'
+    prop_values = '2'
+  [../]
+[]
+
+[Postprocessors]
+  # Any quadrature point left without the property would lower the average
+  [./prop_average]
+    type = ElementAverageValue
+    variable = prop
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = 'PJFNK'
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,62 @@
+[Mesh]
+  type = StreamingGeneratedMesh
+  nx = 10
+  ny = 10
+  nz = 10
+[]
+
+[Variables]
+  [u]
+  []
+[]
+
+[Kernels]
+  [diff]
+    type = Diffusion
+    variable = u
+  []
+[]
+
+[BCs]
+  [left]
+    type = DirichletBC
+    variable = u
+    boundary = 'left'
+    value = 0
+  []
+  [right]
+    type = DirichletBC
+    variable = u
+    boundary = 'right'
+    value = 1
+  []
+[]
+
+[Postprocessors]
+  [num_elems]
+    type = NumElems
+  []
+  [num_nodes]
+    type = NumNodes
+  []
+  [area]
+    type = AreaPostprocessor
+    boundary = 'right'
+  []
+  [integral]
+    type = ElementIntegralVariablePostprocessor
+    variable = u
+  []
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = PJFNK
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+  nl_rel_tol = 1e-12
+[]
+
+[Outputs]
+  csv = true
+[]
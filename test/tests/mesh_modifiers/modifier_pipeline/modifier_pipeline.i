@@ -0,0 +1,67 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 4
+  ny = 4
+[]
+
+[MeshModifiers]
+  # Only changes subdomain ids, so the neighbors stay valid for the deleter
+  [subdomain]
+    type = SubdomainBoundingBox
+    block_id = 1
+    bottom_left = '0 0 0'
+    top_right = '0.5 1 0'
+  []
+  # Leaves the neighbors stale, so the mesh is prepared before the side set is added
+  [delete]
+    type = BlockDeleter
+    block_id = 1
+    depends_on = subdomain
+  []
+  [around]
+    type = SideSetsAroundSubdomain
+    block = 0
+    new_boundary = 10
+    depends_on = delete
+  []
+[]
+
+[Variables]
+  [u]
+  []
+[]
+
+[Kernels]
+  [diff]
+    type = Diffusion
+    variable = u
+  []
+[]
+
+[BCs]
+  [around]
+    type = DirichletBC
+    variable = u
+    boundary = 10
+    value = 1
+  []
+[]
+
+[Postprocessors]
+  [num_elems]
+    type = NumElems
+  []
+  [area]
+    type = AreaPostprocessor
+    boundary = 10
+  []
+[]
+
+[Executioner]
+  type = Steady
+[]
+
+[Outputs]
+  csv = true
+[]
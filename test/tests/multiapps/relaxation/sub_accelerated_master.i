@@ -0,0 +1,93 @@
+# u = v / 2 + t here and v = -3 u / 2 + t in the sub-app, which relaxes v. The coupled solution is
+# u = 6 t / 7 and v = -2 t / 7.
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 1
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./v]
+  [../]
+[]
+
+[Kernels]
+  [./reaction]
+    type = Reaction
+    variable = u
+  [../]
+  [./coupled]
+    type = CoupledForce
+    variable = u
+    v = v
+    coef = 0.5
+  [../]
+  [./source]
+    type = BodyForce
+    variable = u
+    function = 't'
+  [../]
+[]
+
+[Postprocessors]
+  [./picard_its]
+    type = NumPicardIterations
+    execute_on = 'initial timestep_end'
+  [../]
+  [./u_value]
+    type = PointValue
+    variable = u
+    point = '0.5 0 0'
+    execute_on = 'initial timestep_end'
+  [../]
+  [./v_value]
+    type = PointValue
+    variable = v
+    point = '0.5 0 0'
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 2
+  dt = 1
+  solve_type = NEWTON
+  picard_max_its = 30
+[]
+
+[Outputs]
+  csv = true
+[]
+
+[MultiApps]
+  [./sub]
+    type = TransientMultiApp
+    app_type = MooseTestApp
+    execute_on = timestep_begin
+    positions = '0 0 0'
+    input_files = sub_accelerated_sub.i
+  [../]
+[]
+
+[Transfers]
+  [./v_from_sub]
+    type = MultiAppNearestNodeTransfer
+    direction = from_multiapp
+    multi_app = sub
+    source_variable = v
+    variable = v
+  [../]
+  [./u_to_sub]
+    type = MultiAppNearestNodeTransfer
+    direction = to_multiapp
+    multi_app = sub
+    source_variable = u
+    variable = u
+  [../]
+[]
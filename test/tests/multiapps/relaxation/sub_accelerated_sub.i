@@ -0,0 +1,42 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 1
+[]
+
+[Variables]
+  [./v]
+  [../]
+[]
+
+[AuxVariables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./reaction]
+    type = Reaction
+    variable = v
+  [../]
+  [./coupled]
+    type = CoupledForce
+    variable = v
+    v = u
+    coef = -1.5
+  [../]
+  [./source]
+    type = BodyForce
+    variable = v
+    function = 't'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 2
+  dt = 1
+  solve_type = NEWTON
+  relaxed_variables = v
+  relaxation_method = aitken
+[]
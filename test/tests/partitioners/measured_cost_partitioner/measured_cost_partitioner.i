@@ -0,0 +1,91 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+  [Partitioner]
+    # The costs change after the first time step, which triggers a single repartitioning
+    type = MeasuredCostPartitionerTest
+  []
+[]
+
+[Variables]
+  [u]
+  []
+[]
+
+[AuxVariables]
+  [prop1]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+[]
+
+[Kernels]
+  [heat]
+    type = MatDiffusionTest
+    variable = u
+    prop_name = thermal_conductivity
+    prop_state = 'old'
+  []
+  [ie]
+    type = TimeDerivative
+    variable = u
+  []
+[]
+
+[AuxKernels]
+  [prop1_output]
+    type = MaterialRealAux
+    variable = prop1
+    property = thermal_conductivity
+  []
+  [prop1_output_init]
+    type = MaterialRealAux
+    variable = prop1
+    property = thermal_conductivity
+    execute_on = initial
+  []
+[]
+
+[BCs]
+  [left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  []
+  [right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  []
+[]
+
+[Materials]
+  [stateful]
+    type = StatefulTest
+    prop_names = thermal_conductivity
+    prop_values = 1.0
+  []
+[]
+
+[Postprocessors]
+  [integral]
+    type = ElementAverageValue
+    variable = prop1
+    execute_on = 'initial timestep_end'
+  []
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = PJFNK
+  num_steps = 5
+  dt = 0.1
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,73 @@
+[Mesh]
+  type = GeneratedMesh
+  nx = 2
+  ny = 2
+  dim = 2
+[]
+
+[Variables]
+  [./u]
+  [../]
+  [./v]
+  [../]
+[]
+
+[Preconditioning]
+  [./FDP]
+    type = FDP
+    full = true
+    finite_difference_type = native
+  [../]
+[]
+
+[Kernels]
+  [./diff_u]
+    type = Diffusion
+    variable = u
+  [../]
+  [./conv_v]
+    type = CoupledForce
+    variable = v
+    v = u
+  [../]
+  [./diff_v]
+    type = Diffusion
+    variable = v
+  [../]
+[]
+
+[ICs]
+  [./u]
+    variable = u
+    type = RandomIC
+    min = 0.1
+    max = 0.9
+  [../]
+  [./v]
+    variable = v
+    type = RandomIC
+    min = 0.1
+    max = 0.9
+  [../]
+[]
+
+[Postprocessors]
+  [./nonlinear_its]
+    type = NumNonlinearIterations
+  [../]
+  [./linear_its]
+    type = NumLinearIterations
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = NEWTON
+  nl_rel_tol = 1e-6
+  l_tol = 1e-10
+[]
+
+[Outputs]
+  csv = true
+  execute_on = timestep_end
+[]
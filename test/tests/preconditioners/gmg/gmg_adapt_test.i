@@ -0,0 +1,108 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 5
+  ny = 5
+[]
+
+[Functions]
+  [./exact_u]
+    type = ParsedFunction
+    value = x
+  [../]
+  [./exact_v]
+    type = ParsedFunction
+    value = sin(pi*x)*sin(pi*y)
+  [../]
+  [./force_fn_v]
+    type = ParsedFunction
+    value = 2*pi*pi*sin(pi*x)*sin(pi*y)
+  [../]
+[]
+
+[Variables]
+  [./u]
+  [../]
+  [./v]
+  [../]
+[]
+
+[Preconditioning]
+  [./gmg]
+    type = GMG
+    full = true
+    levels = 3
+  [../]
+[]
+
+[Kernels]
+  [./diff_u]
+    type = Diffusion
+    variable = u
+  [../]
+  [./diff_v]
+    type = Diffusion
+    variable = v
+  [../]
+  [./ffn_v]
+    type = BodyForce
+    variable = v
+    function = force_fn_v
+  [../]
+[]
+
+[BCs]
+  [./left_u]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right_u]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+  [./all_v]
+    type = FunctionDirichletBC
+    variable = v
+    boundary = 'left right top bottom'
+    function = exact_v
+  [../]
+[]
+
+[Postprocessors]
+  # The finite element solution is exact on any mesh, hanging nodes included
+  [./u_error]
+    type = ElementL2Error
+    variable = u
+    function = exact_u
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+
+  solve_type = 'NEWTON'
+
+  # A single Newton step whose linear solve has to converge in a few multigrid preconditioned
+  # iterations, the solve fails otherwise
+  nl_max_its = 1
+  nl_rel_tol = 1e-12
+  l_tol = 1e-12
+  l_max_its = 20
+
+  [./Adaptivity]
+    steps = 3
+    refine_fraction = 0.3
+    max_h_level = 3
+  [../]
+[]
+
+[Outputs]
+  [./csv]
+    type = CSV
+    execute_on = timestep_end
+  [../]
+[]
@@ -0,0 +1,31 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 4
+  ny = 4
+  uniform_refine = 1
+[]
+
+[Variables]
+  [./u]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+[]
+
+[Kernels]
+  [./reaction]
+    type = Reaction
+    variable = u
+  [../]
+[]
+
+[Preconditioning]
+  [./gmg]
+    type = GMG
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+[]
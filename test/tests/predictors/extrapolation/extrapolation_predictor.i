@@ -0,0 +1,83 @@
+# The boundary value is quadratic in time, so once three solutions are known the second order
+# extrapolation predicts the solution exactly
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 3
+  ny = 3
+[]
+
+[Functions]
+  [./ramp]
+    type = ParsedFunction
+    value = 't*t'
+  [../]
+
+  # The boundary value jumps back after three steps, so the extrapolation is worse than no prediction
+  [./jump]
+    type = ParsedFunction
+    value = 'if(t<0.35,t,0)'
+  [../]
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./diff_u]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[BCs]
+  [./bottom]
+    type = PresetBC
+    variable = u
+    boundary = bottom
+    value = 0.0
+  [../]
+  [./top]
+    type = FunctionPresetBC
+    variable = u
+    boundary = top
+    function = ramp
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'PJFNK'
+
+  nl_max_its = 15
+  nl_rel_tol = 1e-14
+  nl_abs_tol = 1e-14
+
+  dt = 0.1
+  end_time = 0.5
+
+  [./Predictor]
+    type = ExtrapolationPredictor
+    scale = 1.0
+    history_size = 3
+    order = 2
+  [../]
+[]
+
+[Postprocessors]
+  [./initial_residual_before]
+    type = Residual
+    residual_type = initial_before_preset
+  [../]
+  [./initial_residual_after]
+    type = Residual
+    residual_type = initial_after_preset
+  [../]
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,74 @@
+# The solution u = t is integrated exactly by every stage of every order, so the nodes of the
+# Dirichlet boundary have to hold the boundary value after every step
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 4
+  ny = 4
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = CoefDiffusion
+    variable = u
+    coef = 0.01
+  [../]
+  [./time]
+    type = TimeDerivative
+    variable = u
+  [../]
+  [./source]
+    type = BodyForce
+    variable = u
+  [../]
+[]
+
+[BCs]
+  [./all]
+    type = FunctionDirichletBC
+    variable = u
+    boundary = 'left right top bottom'
+    function = 't'
+  [../]
+[]
+
+[Postprocessors]
+  [./boundary_value]
+    type = PointValue
+    variable = u
+    point = '0 0 0'
+    execute_on = 'initial timestep_end'
+  [../]
+  [./interior_value]
+    type = PointValue
+    variable = u
+    point = '0.5 0.5 0'
+    execute_on = 'initial timestep_end'
+  [../]
+  [./error]
+    type = ElementL2Error
+    variable = u
+    function = 't'
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 4
+  dt = 0.125
+
+  [./TimeIntegrator]
+    type = ExplicitSSPRungeKutta
+    solve_type = lumped
+  [../]
+[]
+
+[Outputs]
+  csv = true
+[]
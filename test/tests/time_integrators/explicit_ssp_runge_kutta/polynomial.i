@@ -0,0 +1,60 @@
+# A method of order p integrates u' = p t^(p-1) exactly, the forcing and the solution are set
+# from the command line for every order
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 4
+  ny = 4
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = CoefDiffusion
+    variable = u
+    coef = 0.01
+  [../]
+  [./time]
+    type = TimeDerivative
+    variable = u
+  [../]
+  [./source]
+    type = BodyForce
+    variable = u
+    function = '1'
+  [../]
+[]
+
+[Postprocessors]
+  [./value]
+    type = PointValue
+    variable = u
+    point = '0.5 0.5 0'
+    execute_on = 'initial timestep_end'
+  [../]
+  [./error]
+    type = ElementL2Error
+    variable = u
+    function = 't'
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 4
+  dt = 0.125
+
+  [./TimeIntegrator]
+    type = ExplicitSSPRungeKutta
+    solve_type = lumped
+  [../]
+[]
+
+[Outputs]
+  csv = true
+[]
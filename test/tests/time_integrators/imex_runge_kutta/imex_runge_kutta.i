@@ -0,0 +1,82 @@
+# Spatially uniform reaction problem du/dt = -u + cos(t), u(0) = 0, with the reaction integrated
+# implicitly and the source explicitly. The exact solution is u = (cos(t) + sin(t) - exp(-t)) / 2.
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 4
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Functions]
+  [./source_fn]
+    type = ParsedFunction
+    value = 'cos(t)'
+  [../]
+  [./exact_fn]
+    type = ParsedFunction
+    value = '(cos(t) + sin(t) - exp(-t)) / 2'
+  [../]
+[]
+
+[Kernels]
+  [./time]
+    type = TimeDerivative
+    variable = u
+  [../]
+
+  [./diffusion]
+    type = Diffusion
+    variable = u
+  [../]
+
+  [./reaction]
+    type = Reaction
+    variable = u
+  [../]
+
+  [./source]
+    type = BodyForce
+    variable = u
+    function = source_fn
+    vector_tags = explicit
+    matrix_tags = explicit
+  [../]
+[]
+
+[Postprocessors]
+  [./average]
+    type = ElementAverageValue
+    variable = u
+  [../]
+  [./error]
+    type = ElementL2Error
+    variable = u
+    function = exact_fn
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+
+  solve_type = 'NEWTON'
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+
+  num_steps = 10
+  dt = 0.1
+
+  nl_abs_tol = 1e-12
+
+  [./TimeIntegrator]
+    type = IMEXRungeKutta
+  [../]
+[]
+
+[Outputs]
+  csv = true
+  execute_on = timestep_end
+[]
@@ -0,0 +1,82 @@
+# The solution is uniform in space, so that it follows the ODE u' = -u + cos(t), u(0) = 0 and the
+# time step sizes and error estimates can be checked against a scalar computation
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 4
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Functions]
+  [./forcing_fn]
+    type = ParsedFunction
+    value = 'cos(t)'
+  [../]
+[]
+
+[Kernels]
+  [./time]
+    type = TimeDerivative
+    variable = u
+  [../]
+
+  [./diffusion]
+    type = Diffusion
+    variable = u
+  [../]
+
+  [./reaction]
+    type = Reaction
+    variable = u
+  [../]
+
+  [./forcing]
+    type = BodyForce
+    variable = u
+    function = forcing_fn
+  [../]
+[]
+
+[Postprocessors]
+  [./dt]
+    type = TimestepSize
+  [../]
+
+  [./error]
+    type = TimeIntegratorErrorEstimate
+    abs_tol = 1e-4
+    rel_tol = 1e-4
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+
+  solve_type = 'NEWTON'
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+  nl_abs_tol = 1e-13
+  nl_rel_tol = 1e-14
+
+  end_time = 1
+
+  [./TimeIntegrator]
+    type = LStableDirk3
+  [../]
+
+  [./TimeStepper]
+    type = ErrorAdaptiveDT
+    dt = 0.05
+    abs_tol = 1e-4
+    rel_tol = 1e-4
+  [../]
+[]
+
+[Outputs]
+  csv = true
+  execute_on = timestep_end
+[]